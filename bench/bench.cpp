@@ -0,0 +1,167 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Microbenchmark harness with JSON results
+*/
+
+#include "bench.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+#ifndef JETPACK_BENCH_BUILD_TYPE
+#define JETPACK_BENCH_BUILD_TYPE "unknown"
+#endif
+
+namespace jetpack {
+namespace bench {
+
+namespace {
+
+std::string escapeJson(const std::string &text) {
+  std::string escaped;
+  for (char c : text) {
+    if (c == '"' || c == '\\')
+      escaped += '\\';
+    escaped += c;
+  }
+  return escaped;
+}
+
+} // namespace
+
+const sim_map_t &benchmarkMap() {
+  static sim_map_t map = [] {
+    sim_map_t generated{};
+    if (!bench_map_generate(&generated, 16, 240, 42)) {
+      std::cerr << "Cannot allocate the benchmark map" << std::endl;
+      std::exit(84);
+    }
+    return generated;
+  }();
+  return map;
+}
+
+void Suite::add(Case benchmarkCase) {
+  cases_.push_back(std::move(benchmarkCase));
+}
+
+void Suite::add(const std::string &name,
+                std::function<void(uint64_t iterations)> run) {
+  add(Case{name, std::move(run), nullptr, nullptr});
+}
+
+void Suite::skip(const std::string &name, const std::string &reason) {
+  skipped_.emplace_back(name, reason);
+}
+
+double Suite::timeBatch(const Case &benchmarkCase, uint64_t iterations,
+                        debug::AllocCounts *allocs) {
+  if (benchmarkCase.setUp)
+    benchmarkCase.setUp();
+  debug::AllocScope scope;
+  auto start = std::chrono::steady_clock::now();
+  benchmarkCase.run(iterations);
+  auto end = std::chrono::steady_clock::now();
+  if (allocs) {
+    debug::AllocCounts batch = scope.elapsed();
+    allocs->allocations += batch.allocations;
+    allocs->bytes += batch.bytes;
+  }
+  if (benchmarkCase.tearDown)
+    benchmarkCase.tearDown();
+  return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+uint64_t Suite::calibrate(const Case &benchmarkCase, double minBatchMs) {
+  uint64_t iterations = 1;
+
+  // Doubling also serves as the warm-up of caches and lazy allocations
+  while (iterations < (1ULL << 40)) {
+    double elapsedNs = timeBatch(benchmarkCase, iterations);
+    if (elapsedNs >= minBatchMs * 1e6)
+      break;
+    if (elapsedNs * 8 < minBatchMs * 1e6)
+      iterations *= 8;
+    else
+      iterations *= 2;
+  }
+  return iterations;
+}
+
+std::vector<Result> Suite::run(const Options &options) const {
+  std::vector<Result> results;
+
+  for (const auto &benchmarkCase : cases_) {
+    if (benchmarkCase.name.find(options.filter) == std::string::npos)
+      continue;
+
+    Result result;
+    std::vector<double> perOp;
+    debug::AllocCounts allocs;
+    result.name = benchmarkCase.name;
+    result.iterations = calibrate(benchmarkCase, options.minBatchMs);
+    result.repetitions = options.repetitions;
+    for (int i = 0; i < options.repetitions; i++) {
+      perOp.push_back(timeBatch(benchmarkCase, result.iterations, &allocs) /
+                      result.iterations);
+    }
+    double ops = static_cast<double>(result.iterations) * result.repetitions;
+    result.allocsPerOp = allocs.allocations / ops;
+    result.allocBytesPerOp = allocs.bytes / ops;
+    std::sort(perOp.begin(), perOp.end());
+    result.medianNs = perOp[perOp.size() / 2];
+    result.minNs = perOp.front();
+    result.maxNs = perOp.back();
+    std::cerr << std::left << std::setw(44) << result.name << std::right
+              << std::fixed << std::setprecision(1) << std::setw(12)
+              << result.medianNs << " ns/op";
+    if (debug::allocTrackingEnabled())
+      std::cerr << std::setw(10) << result.allocsPerOp << " allocs/op";
+    std::cerr << std::endl;
+    results.push_back(result);
+  }
+  return results;
+}
+
+void Suite::writeJson(std::ostream &out, const Options &options,
+                      const std::vector<Result> &results) const {
+  out << "{\n  \"suite\": \"jetpack_bench\",\n"
+      << "  \"build_type\": \"" << escapeJson(JETPACK_BENCH_BUILD_TYPE)
+      << "\",\n  \"compiler\": \"" << escapeJson(__VERSION__) << "\",\n"
+      << "  \"timestamp\": " << std::time(nullptr) << ",\n"
+      << "  \"repetitions\": " << options.repetitions << ",\n"
+      << "  \"alloc_tracking\": "
+      << (debug::allocTrackingEnabled() ? "true" : "false") << ",\n"
+      << "  \"results\": [";
+  out << std::fixed << std::setprecision(2);
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result &result = results[i];
+    out << (i ? ",\n" : "\n") << "    {\"name\": \""
+        << escapeJson(result.name) << "\", \"iterations\": "
+        << result.iterations << ", \"ns_per_op\": " << result.medianNs
+        << ", \"min_ns_per_op\": " << result.minNs
+        << ", \"max_ns_per_op\": " << result.maxNs;
+    if (debug::allocTrackingEnabled()) {
+      out << ", \"allocs_per_op\": " << result.allocsPerOp
+          << ", \"alloc_bytes_per_op\": " << result.allocBytesPerOp;
+    }
+    out << "}";
+  }
+  out << "\n  ],\n  \"skipped\": [";
+  for (size_t i = 0; i < skipped_.size(); i++) {
+    out << (i ? ",\n" : "\n") << "    {\"name\": \""
+        << escapeJson(skipped_[i].first) << "\", \"reason\": \""
+        << escapeJson(skipped_[i].second) << "\"}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+} // namespace bench
+} // namespace jetpack
@@ -0,0 +1,96 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Microbenchmark harness with JSON results
+*/
+
+#ifndef BENCH_BENCH_HPP_
+#define BENCH_BENCH_HPP_
+
+#include "bench_server.h"
+#include "debug/alloc_counter.hpp"
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace bench {
+
+// Keep value observable so the optimizer cannot drop the work producing it
+template <typename T> inline void keep(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Same for the bytes behind pointer
+inline void keepMemory(const void *pointer) {
+  asm volatile("" : : "r"(pointer) : "memory");
+}
+
+struct Case {
+  std::string name;
+  // Runs the measured operation this many times
+  std::function<void(uint64_t iterations)> run;
+  // Untimed, around every batch of iterations (may be empty)
+  std::function<void()> setUp;
+  std::function<void()> tearDown;
+};
+
+struct Result {
+  std::string name;
+  uint64_t iterations = 0; // Per repetition
+  int repetitions = 0;
+  double medianNs = 0.0; // Per operation
+  double minNs = 0.0;
+  double maxNs = 0.0;
+  // Over every timed batch; only filled with JETPACK_ALLOC_TRACKING
+  double allocsPerOp = 0.0;
+  double allocBytesPerOp = 0.0;
+};
+
+struct Options {
+  std::string filter;      // Substring of the case names to run
+  int repetitions = 5;     // Timed batches per case, the median is reported
+  double minBatchMs = 50;  // Calibrated batch length
+  std::string outputPath;  // JSON file, stdout when empty
+};
+
+class Suite {
+public:
+  void add(Case benchmarkCase);
+  void add(const std::string &name,
+           std::function<void(uint64_t iterations)> run);
+  // Cases skipped at registration, listed in the report with the reason
+  void skip(const std::string &name, const std::string &reason);
+
+  std::vector<Result> run(const Options &options) const;
+  void writeJson(std::ostream &out, const Options &options,
+                 const std::vector<Result> &results) const;
+
+private:
+  std::vector<Case> cases_;
+  std::vector<std::pair<std::string, std::string>> skipped_;
+
+  // Allocations of the timed part are added to allocs when not null
+  static double timeBatch(const Case &benchmarkCase, uint64_t iterations,
+                          debug::AllocCounts *allocs = nullptr);
+  static uint64_t calibrate(const Case &benchmarkCase, double minBatchMs);
+};
+
+// Generated map shared by every area: 16 rows by 240 columns, the widest
+// map the server's one-byte MAP_CHUNK column index can stream
+const sim_map_t &benchmarkMap();
+
+// Registration, one function per area
+void registerProtocolBenchmarks(Suite &suite);
+void registerGameStateBenchmarks(Suite &suite);
+void registerServerBenchmarks(Suite &suite);
+void registerRenderBenchmarks(Suite &suite);
+
+} // namespace bench
+} // namespace jetpack
+
+#endif // BENCH_BENCH_HPP_
@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Deterministic maps for the benchmarks
+*/
+
+#include "bench_server.h"
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t next_random(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/* The first columns stay empty so every player survives the start. */
+static void fill_column(sim_map_t *map, size_t col, uint32_t *state)
+{
+    uint32_t roll = next_random(state);
+    size_t row = (roll >> 8) % map->row_count;
+
+    if (col < 8)
+        return;
+    if (roll % 16 == 0) {
+        map->rows[row][col] = 'e';
+        map->rows[(row + 1) % map->row_count][col] = 'e';
+    }
+    if (roll % 16 >= 1 && roll % 16 <= 3)
+        map->rows[row][col] = 'c';
+    if (roll % 64 == 4)
+        map->rows[row][col] = '#';
+}
+
+bool bench_map_generate(sim_map_t *map, size_t rows, size_t cols,
+    uint32_t seed)
+{
+    uint32_t state = seed != 0 ? seed : 1;
+
+    map->row_count = rows;
+    map->col_count = cols + 1;
+    map->rows = calloc(rows, sizeof(char *));
+    if (map->rows == NULL)
+        return false;
+    for (size_t row = 0; row < rows; row++) {
+        map->rows[row] = calloc(cols + 2, sizeof(char));
+        if (map->rows[row] == NULL)
+            return false;
+        memset(map->rows[row], '_', cols);
+        map->rows[row][cols] = '\n';
+    }
+    for (size_t col = 0; col < cols; col++)
+        fill_column(map, col, &state);
+    return true;
+}
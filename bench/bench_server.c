@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Socket-free server ticks for the benchmarks
+*/
+
+#include "bench_server.h"
+#include "server.h"
+
+struct bench_server_s {
+    server_t server;
+    sim_map_t pristine;
+    uint8_t inputs[SIM_MAX_PLAYERS];
+    uint32_t seed;
+};
+
+bench_server_t *bench_server_create(const sim_map_t *map, int players)
+{
+    bench_server_t *bench = calloc(1, sizeof(bench_server_t));
+
+    if (bench == NULL)
+        return NULL;
+    bench->seed = 0x9E3779B9u;
+    bench->server.client_count = players;
+    sim_init(&bench->server.sim);
+    for (int i = 0; i < players; i++)
+        sim_add_player(&bench->server.sim);
+    if (!sim_map_copy(&bench->pristine, map) ||
+        !sim_restart(&bench->server.sim, map)) {
+        bench_server_destroy(bench);
+        return NULL;
+    }
+    return bench;
+}
+
+void bench_server_destroy(bench_server_t *bench)
+{
+    if (bench == NULL)
+        return;
+    sim_map_free(&bench->pristine);
+    sim_map_free(&bench->server.sim.map);
+    free(bench);
+}
+
+void bench_server_step(bench_server_t *bench)
+{
+    sim_t *sim = &bench->server.sim;
+
+    for (int i = 0; i < sim->player_count; i++) {
+        bench->seed ^= bench->seed << 13;
+        bench->seed ^= bench->seed >> 17;
+        bench->seed ^= bench->seed << 5;
+        bench->inputs[i] ^= (bench->seed & 7) == 0;
+    }
+    sim_step(sim, bench->inputs);
+    if (sim->status == SIM_ENDED)
+        sim_restart(sim, &bench->pristine);
+    bench->server.tick++;
+}
+
+size_t bench_server_encode_state(bench_server_t *bench, uint8_t *buffer)
+{
+    server_t *server = &bench->server;
+    uint16_t length = 9 + server->client_count * 9;
+    size_t offset = 9;
+
+    write_header(buffer, GAME_STATE, length);
+    write_state_payload(buffer, server, server->client_count);
+    for (int i = 0; i < server->client_count; i++) {
+        write_data_state_payload(buffer, &server->sim.players[i], offset, i);
+        offset += 9;
+    }
+    return length;
+}
+
+size_t bench_server_tick(bench_server_t *bench, uint8_t *buffer)
+{
+    int events;
+    size_t length;
+
+    bench_server_step(bench);
+    length = bench_server_encode_state(bench, buffer);
+    events = bench->server.sim.coin_event_count;
+    if (events == 0)
+        return length;
+    write_header(buffer + length, COIN_EVENT, 10 + events * 5);
+    write_coin_events_payload(buffer + length, &bench->server);
+    return length + 10 + events * 5;
+}
@@ -0,0 +1,46 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** C side of the benchmarks: generated maps and socket-free server ticks
+*/
+
+#ifndef BENCH_SERVER_H_
+    #define BENCH_SERVER_H_
+
+    #include "sim.h"
+
+    // Largest tick: GAME_STATE with every player, then a full COIN_EVENT
+    #define BENCH_PACKET_SIZE \
+        (9 + SIM_MAX_PLAYERS * 9 + 10 + SIM_MAX_COIN_EVENTS * 5)
+
+    #ifdef __cplusplus
+extern "C" {
+    #endif
+
+typedef struct bench_server_s bench_server_t;
+
+// Deterministic map with walls, coin columns and zapper pairs
+bool bench_map_generate(sim_map_t *map, size_t rows, size_t cols,
+    uint32_t seed);
+
+// A lobby-less server holding players on a copy of map
+bench_server_t *bench_server_create(const sim_map_t *map, int players);
+void bench_server_destroy(bench_server_t *bench);
+
+// Random inputs then sim_step; a finished match restarts on a fresh map
+void bench_server_step(bench_server_t *bench);
+
+// One game tick without sockets: bench_server_step, then the GAME_STATE
+// and COIN_EVENT packets encoded back to back into buffer as the game
+// loop would send them; returns the bytes encoded
+size_t bench_server_tick(bench_server_t *bench, uint8_t *buffer);
+
+// GAME_STATE packet of the current tick, written with the server encoders
+size_t bench_server_encode_state(bench_server_t *bench, uint8_t *buffer);
+
+    #ifdef __cplusplus
+}
+    #endif
+
+#endif /* !BENCH_SERVER_H_ */
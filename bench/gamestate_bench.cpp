@@ -0,0 +1,116 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** GameState getter benchmarks under writer contention
+*/
+
+#include "bench.hpp"
+#include "gamestate.hpp"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace jetpack {
+namespace bench {
+
+namespace {
+
+const int WRITER_COUNTS[] = {0, 1, 3};
+const int PLAYERS = 64;
+
+// Shared state plus writer threads that mimic the network thread applying
+// GAME_STATE and COIN_EVENT packets back to back
+class Contention {
+public:
+  explicit Contention(int writers) : writers_(writers) {
+    const sim_map_t &map = benchmarkMap();
+    gameState_.setMapDimensions(static_cast<uint16_t>(map.col_count),
+                                static_cast<uint16_t>(map.row_count));
+    for (int i = 0; i < PLAYERS; i++) {
+      states_.push_back({static_cast<uint8_t>(i), 1, 500, 0, 1, 0});
+    }
+    gameState_.setPlayerStates(states_);
+  }
+
+  void start() {
+    running_ = true;
+    for (int i = 0; i < writers_; i++) {
+      threads_.emplace_back([this, i] { write(i); });
+    }
+  }
+
+  void stop() {
+    running_ = false;
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+    threads_.clear();
+  }
+
+  GameState &gameState() { return gameState_; }
+
+private:
+  GameState gameState_;
+  std::vector<protocol::PlayerState> states_;
+  int writers_;
+  std::atomic<bool> running_{false};
+  std::vector<std::thread> threads_;
+
+  void write(int writer) {
+    std::vector<protocol::PlayerState> states = states_;
+    std::vector<protocol::CoinEvent> events = {{0, 0}};
+    uint32_t tick = 0;
+
+    while (running_.load(std::memory_order_relaxed)) {
+      states[tick % PLAYERS].posX = static_cast<uint16_t>(tick % 1000);
+      gameState_.setPlayerStates(states);
+      gameState_.setCurrentTick(tick);
+      events[0].coinId = (tick * 7 + writer) % 241;
+      gameState_.applyCoinEvents(events);
+      tick++;
+    }
+  }
+};
+
+void addContended(Suite &suite, const std::string &getter, int writers,
+                  std::function<void(GameState &, uint64_t)> body) {
+  auto contention = std::make_shared<Contention>(writers);
+  suite.add(Case{"gamestate/" + getter + "/writers:" + std::to_string(writers),
+                 [contention, body](uint64_t iterations) {
+                   body(contention->gameState(), iterations);
+                 },
+                 [contention] { contention->start(); },
+                 [contention] { contention->stop(); }});
+}
+
+} // namespace
+
+void registerGameStateBenchmarks(Suite &suite) {
+  for (int writers : WRITER_COUNTS) {
+    addContended(suite, "get_snapshot", writers,
+                 [](GameState &gameState, uint64_t iterations) {
+                   GameSnapshot snapshot;
+                   for (uint64_t i = 0; i < iterations; i++) {
+                     gameState.getSnapshot(&snapshot);
+                     keep(snapshot.currentTick);
+                   }
+                 });
+    addContended(suite, "get_player_states", writers,
+                 [](GameState &gameState, uint64_t iterations) {
+                   for (uint64_t i = 0; i < iterations; i++) {
+                     keep(gameState.getPlayerStates().size());
+                   }
+                 });
+    addContended(suite, "is_jetpack_active", writers,
+                 [](GameState &gameState, uint64_t iterations) {
+                   for (uint64_t i = 0; i < iterations; i++) {
+                     keep(gameState.isJetpackActive());
+                   }
+                 });
+  }
+}
+
+} // namespace bench
+} // namespace jetpack
@@ -0,0 +1,88 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Benchmark suite entrypoint
+*/
+
+#include "bench.hpp"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+
+void print_usage(const char *program_name) {
+  std::cout << "Usage: " << program_name
+            << " [-o <file.json>] [-f <filter>] [-r <repetitions>]"
+               " [-m <batch ms>]"
+            << std::endl;
+  std::cout << "  -o <file>     Write the JSON results there (default stdout)"
+            << std::endl;
+  std::cout << "  -f <filter>   Only run cases whose name contains filter"
+            << std::endl;
+  std::cout << "  -r <count>    Timed batches per case, median reported "
+               "(default 5)"
+            << std::endl;
+  std::cout << "  -m <ms>       Minimum length of one batch (default 50)"
+            << std::endl;
+}
+
+bool parse_int(const char *text, int min, int *value) {
+  try {
+    *value = std::stoi(text);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return *value >= min;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  jetpack::bench::Options options;
+  int batchMs = static_cast<int>(options.minBatchMs);
+  bool valid = true;
+
+  for (int i = 1; i < argc && valid; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+
+    if (arg == "-o" && hasValue) {
+      options.outputPath = argv[++i];
+    } else if (arg == "-f" && hasValue) {
+      options.filter = argv[++i];
+    } else if (arg == "-r" && hasValue) {
+      valid = parse_int(argv[++i], 1, &options.repetitions);
+    } else if (arg == "-m" && hasValue) {
+      valid = parse_int(argv[++i], 1, &batchMs);
+    } else {
+      valid = false;
+    }
+  }
+  if (!valid) {
+    print_usage(argv[0]);
+    return 84;
+  }
+  options.minBatchMs = batchMs;
+
+  jetpack::bench::Suite suite;
+  jetpack::bench::registerProtocolBenchmarks(suite);
+  jetpack::bench::registerGameStateBenchmarks(suite);
+  jetpack::bench::registerServerBenchmarks(suite);
+  jetpack::bench::registerRenderBenchmarks(suite);
+
+  auto results = suite.run(options);
+  if (options.outputPath.empty()) {
+    suite.writeJson(std::cout, options, results);
+    return 0;
+  }
+  std::ofstream out(options.outputPath);
+  if (!out) {
+    std::cerr << "Cannot write " << options.outputPath << std::endl;
+    return 84;
+  }
+  suite.writeJson(out, options, results);
+  return 0;
+}
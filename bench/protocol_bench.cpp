@@ -0,0 +1,124 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** MJP encode and decode benchmarks
+*/
+
+#include "bench.hpp"
+#include "network/protocol_handlers.hpp"
+#include <arpa/inet.h>
+#include <cstring>
+#include <memory>
+
+namespace jetpack {
+namespace bench {
+
+namespace {
+
+const int PLAYER_COUNTS[] = {2, 64, 255};
+
+// MAP_CHUNK payloads of the benchmark map, one per column as the server
+// streams them
+std::vector<std::vector<uint8_t>> mapChunkPayloads() {
+  const sim_map_t &map = benchmarkMap();
+  std::vector<std::vector<uint8_t>> payloads;
+
+  for (size_t col = 0; col < map.col_count; col++) {
+    std::vector<uint8_t> payload = {
+        0, static_cast<uint8_t>(col), static_cast<uint8_t>(map.col_count >> 8),
+        static_cast<uint8_t>(map.col_count)};
+    for (size_t row = 0; row < map.row_count; row++) {
+      payload.push_back(static_cast<uint8_t>(map.rows[row][col]));
+    }
+    payloads.push_back(std::move(payload));
+  }
+  return payloads;
+}
+
+// GAME_STATE payload (header stripped) after a few ticks of play
+std::vector<uint8_t> gameStatePayload(int players) {
+  std::vector<uint8_t> packet(BENCH_PACKET_SIZE);
+  bench_server_t *server = bench_server_create(&benchmarkMap(), players);
+
+  for (int tick = 0; tick < 20; tick++) {
+    bench_server_step(server);
+  }
+  size_t length = bench_server_encode_state(server, packet.data());
+  bench_server_destroy(server);
+  return std::vector<uint8_t>(packet.begin() + 4, packet.begin() + length);
+}
+
+void registerHeader(Suite &suite) {
+  suite.add("protocol/header_encode", [](uint64_t iterations) {
+    uint8_t buffer[sizeof(protocol::PacketHeader)];
+    for (uint64_t i = 0; i < iterations; i++) {
+      protocol::PacketHeader header;
+      header.magic = protocol::MAGIC_BYTE;
+      header.type = protocol::CLIENT_INPUT;
+      header.length = htons(static_cast<uint16_t>(6 + (i & 1)));
+      std::memcpy(buffer, &header, sizeof(header));
+      keepMemory(buffer);
+    }
+  });
+  suite.add("protocol/header_decode", [](uint64_t iterations) {
+    const uint8_t bytes[] = {protocol::MAGIC_BYTE, protocol::GAME_STATE, 0x09,
+                             0x1B};
+    uint64_t total = 0;
+    for (uint64_t i = 0; i < iterations; i++) {
+      protocol::PacketHeader header;
+      std::memcpy(&header, bytes, sizeof(header));
+      keep(header);
+      if (header.magic == protocol::MAGIC_BYTE)
+        total += ntohs(header.length);
+    }
+    keep(total);
+  });
+}
+
+} // namespace
+
+void registerProtocolBenchmarks(Suite &suite) {
+  registerHeader(suite);
+
+  for (int players : PLAYER_COUNTS) {
+    std::string suffix = "/players:" + std::to_string(players);
+    auto server = std::shared_ptr<bench_server_t>(
+        bench_server_create(&benchmarkMap(), players), bench_server_destroy);
+    suite.add("protocol/game_state_encode" + suffix,
+              [server](uint64_t iterations) {
+                uint8_t packet[BENCH_PACKET_SIZE];
+                for (uint64_t i = 0; i < iterations; i++) {
+                  keep(bench_server_encode_state(server.get(), packet));
+                  keepMemory(packet);
+                }
+              });
+
+    auto payload = gameStatePayload(players);
+    suite.add("protocol/game_state_decode" + suffix,
+              [payload](uint64_t iterations) {
+                GameState gameState;
+                network::ProtocolHandlers handlers(&gameState);
+                for (uint64_t i = 0; i < iterations; i++) {
+                  handlers.handleGameState(payload);
+                }
+              });
+  }
+
+  auto chunks = mapChunkPayloads();
+  suite.add("protocol/process_complete_map/16x240",
+            [chunks](uint64_t iterations) {
+              GameState gameState;
+              network::ProtocolHandlers handlers(&gameState);
+              for (uint64_t i = 0; i < iterations; i++) {
+                for (const auto &chunk : chunks) {
+                  handlers.handleMapChunk(chunk);
+                }
+              }
+              keep(gameState.getMapRevision());
+            });
+}
+
+} // namespace bench
+} // namespace jetpack
@@ -0,0 +1,103 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Offscreen tile map rendering benchmarks
+*/
+
+#include "bench.hpp"
+
+#ifdef JETPACK_BENCH_RENDER
+#include "graphics/tile_map.hpp"
+#include "network/protocol_handlers.hpp"
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <tuple>
+#endif
+
+namespace jetpack {
+namespace bench {
+
+#ifdef JETPACK_BENCH_RENDER
+
+namespace {
+
+const float TILE_SIZE = 20.0f;
+
+// Offscreen target and tile map built from the benchmark map; the view
+// scrolls one tile per frame and wraps at the end of the map
+struct TileScene {
+  sf::RenderTexture target;
+  graphics::TileMap tileMap{TILE_SIZE};
+  sf::View view{sf::FloatRect(0, 0, 800, 600)};
+  uint16_t width = 0;
+  uint16_t height = 0;
+  std::vector<uint8_t> tiles;
+
+  bool initialize() {
+    const sim_map_t &map = benchmarkMap();
+    GameState gameState;
+    network::ProtocolHandlers handlers(&gameState);
+
+    for (size_t col = 0; col < map.col_count; col++) {
+      std::vector<uint8_t> chunk = {0, static_cast<uint8_t>(col),
+                                    static_cast<uint8_t>(map.col_count >> 8),
+                                    static_cast<uint8_t>(map.col_count)};
+      for (size_t row = 0; row < map.row_count; row++) {
+        chunk.push_back(static_cast<uint8_t>(map.rows[row][col]));
+      }
+      handlers.handleMapChunk(chunk);
+    }
+    std::tie(width, height) = gameState.getMapDimensions();
+    tiles = gameState.getMapData();
+    if (!target.create(800, 600) || !tileMap.initialize())
+      return false;
+    tileMap.setMap(width, height, tiles);
+    return true;
+  }
+
+  void frame(uint64_t index) {
+    float span = width * TILE_SIZE - 800.0f;
+    view.setCenter(400.0f + static_cast<float>(index % 1000) / 1000 * span,
+                   300.0f);
+    target.clear();
+    tileMap.draw(target, view);
+    target.display();
+  }
+};
+
+} // namespace
+
+void registerRenderBenchmarks(Suite &suite) {
+  auto scene = std::make_shared<TileScene>();
+  if (!scene->initialize()) {
+    suite.skip("render/tile_map", "no OpenGL context for sf::RenderTexture");
+    return;
+  }
+
+  // Chunks baked once, then only drawn
+  suite.add("render/tile_map/baked", [scene](uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+      scene->frame(i);
+    }
+  });
+  // Every visible chunk rebuilt, as after a new map or a coin change
+  suite.add("render/tile_map/rebuild", [scene](uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+      scene->tileMap.setMap(scene->width, scene->height, scene->tiles);
+      scene->frame(i);
+    }
+  });
+}
+
+#else
+
+void registerRenderBenchmarks(Suite &suite) {
+  suite.skip("render/tile_map", "built without SFML");
+}
+
+#endif
+
+} // namespace bench
+} // namespace jetpack
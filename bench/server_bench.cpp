@@ -0,0 +1,45 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Server tick benchmarks on the shared simulation library
+*/
+
+#include "bench.hpp"
+#include <memory>
+
+namespace jetpack {
+namespace bench {
+
+namespace {
+
+const int PLAYER_COUNTS[] = {2, 64, 255};
+
+} // namespace
+
+void registerServerBenchmarks(Suite &suite) {
+  for (int players : PLAYER_COUNTS) {
+    std::string suffix = "/players:" + std::to_string(players);
+    auto server = std::shared_ptr<bench_server_t>(
+        bench_server_create(&benchmarkMap(), players), bench_server_destroy);
+
+    // Rules only, as jetpack_simulate runs them
+    suite.add("server/sim_step" + suffix, [server](uint64_t iterations) {
+      for (uint64_t i = 0; i < iterations; i++) {
+        bench_server_step(server.get());
+      }
+    });
+    // Rules plus the packets the game loop encodes each tick
+    suite.add("server/tick" + suffix, [server](uint64_t iterations) {
+      uint8_t packet[BENCH_PACKET_SIZE];
+      for (uint64_t i = 0; i < iterations; i++) {
+        keep(bench_server_tick(server.get(), packet));
+        keepMemory(packet);
+      }
+    });
+  }
+}
+
+} // namespace bench
+} // namespace jetpack
@@ -0,0 +1,71 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Dense per-tile bitmap of collected coins
+*/
+
+#ifndef CLIENT_COIN_BITMAP_HPP_
+#define CLIENT_COIN_BITMAP_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace jetpack {
+
+// One bit per map tile, row-major like the map data
+class CoinBitmap {
+public:
+  void resize(uint16_t width, uint16_t height) {
+    width_ = width;
+    height_ = height;
+    words_.assign((static_cast<size_t>(width) * height + 63) / 64, 0);
+  }
+
+  // Returns true when the bit was not already set
+  bool set(uint16_t tileX, uint16_t tileY) {
+    if (tileX >= width_ || tileY >= height_)
+      return false;
+    return setIndex(static_cast<size_t>(tileY) * width_ + tileX);
+  }
+
+  // Same as set() for a row-major tile index
+  bool setIndex(size_t bit) {
+    if (bit >= static_cast<size_t>(width_) * height_)
+      return false;
+    uint64_t mask = uint64_t(1) << (bit & 63);
+    if (words_[bit >> 6] & mask)
+      return false;
+    words_[bit >> 6] |= mask;
+    return true;
+  }
+
+  bool test(uint16_t tileX, uint16_t tileY) const {
+    if (tileX >= width_ || tileY >= height_)
+      return false;
+    size_t bit = static_cast<size_t>(tileY) * width_ + tileX;
+    return (words_[bit >> 6] >> (bit & 63)) & 1;
+  }
+
+  uint16_t width() const { return width_; }
+  uint16_t height() const { return height_; }
+  const std::vector<uint64_t> &words() const { return words_; }
+
+private:
+  uint16_t width_ = 0;
+  uint16_t height_ = 0;
+  std::vector<uint64_t> words_;
+};
+
+// Copy of both owners' bitmaps, refreshed once per frame by the renderer
+struct CoinSnapshot {
+  uint32_t revision = 0;
+  CoinBitmap local;
+  CoinBitmap other;
+};
+
+} // namespace jetpack
+
+#endif // CLIENT_COIN_BITMAP_HPP_
@@ -0,0 +1,124 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Allocation counters and the operator new/delete replacements
+*/
+
+#include "alloc_counter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace jetpack {
+namespace debug {
+
+namespace {
+
+// Constant-initialised, so reading it never allocates nor runs a TLS guard
+thread_local AllocCounts t_counts;
+
+std::atomic<uint64_t> g_packets(0);
+std::atomic<uint64_t> g_packetAllocations(0);
+std::atomic<uint64_t> g_packetFrees(0);
+std::atomic<uint64_t> g_packetBytes(0);
+
+} // namespace
+
+namespace detail {
+
+// Shared by every replaced operator below
+void *countedAlloc(std::size_t size) {
+  t_counts.allocations++;
+  t_counts.bytes += size;
+  return std::malloc(size ? size : 1);
+}
+
+void countedFree(void *pointer) {
+  if (pointer) {
+    t_counts.frees++;
+    std::free(pointer);
+  }
+}
+
+} // namespace detail
+
+AllocCounts operator-(const AllocCounts &after, const AllocCounts &before) {
+  AllocCounts difference;
+
+  difference.allocations = after.allocations - before.allocations;
+  difference.frees = after.frees - before.frees;
+  difference.bytes = after.bytes - before.bytes;
+  return difference;
+}
+
+AllocCounts threadAllocCounts() { return t_counts; }
+
+void recordPacketAllocs(const AllocCounts &counts) {
+  g_packets.fetch_add(1, std::memory_order_relaxed);
+  g_packetAllocations.fetch_add(counts.allocations, std::memory_order_relaxed);
+  g_packetFrees.fetch_add(counts.frees, std::memory_order_relaxed);
+  g_packetBytes.fetch_add(counts.bytes, std::memory_order_relaxed);
+}
+
+PacketAllocStats packetAllocStats() {
+  PacketAllocStats stats;
+
+  stats.packets = g_packets.load(std::memory_order_relaxed);
+  stats.counts.allocations =
+      g_packetAllocations.load(std::memory_order_relaxed);
+  stats.counts.frees = g_packetFrees.load(std::memory_order_relaxed);
+  stats.counts.bytes = g_packetBytes.load(std::memory_order_relaxed);
+  return stats;
+}
+
+} // namespace debug
+} // namespace jetpack
+
+#ifdef JETPACK_ALLOC_TRACKING
+
+// Over-aligned new and delete are left to the standard library: nothing in
+// the client asks for more than the default alignment
+using jetpack::debug::detail::countedAlloc;
+using jetpack::debug::detail::countedFree;
+
+void *operator new(std::size_t size) {
+  void *pointer = countedAlloc(size);
+
+  if (!pointer)
+    throw std::bad_alloc();
+  return pointer;
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return countedAlloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return countedAlloc(size);
+}
+
+void operator delete(void *pointer) noexcept { countedFree(pointer); }
+
+void operator delete[](void *pointer) noexcept { countedFree(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept {
+  countedFree(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+  countedFree(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+  countedFree(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+  countedFree(pointer);
+}
+
+#endif
@@ -0,0 +1,62 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Opt-in per-thread counters of the global operator new and delete
+*/
+
+#ifndef CLIENT_DEBUG_ALLOC_COUNTER_HPP_
+#define CLIENT_DEBUG_ALLOC_COUNTER_HPP_
+
+#include <cstdint>
+
+namespace jetpack {
+namespace debug {
+
+struct AllocCounts {
+  uint64_t allocations = 0;
+  uint64_t frees = 0;
+  uint64_t bytes = 0; // Requested from operator new; deletes are not sized
+};
+
+AllocCounts operator-(const AllocCounts &after, const AllocCounts &before);
+
+// Whether the build replaces operator new and delete (cmake
+// -DJETPACK_ALLOC_TRACKING=ON); every counter stays at zero otherwise
+constexpr bool allocTrackingEnabled() {
+#ifdef JETPACK_ALLOC_TRACKING
+  return true;
+#else
+  return false;
+#endif
+}
+
+// Everything the calling thread allocated since it started
+AllocCounts threadAllocCounts();
+
+// Allocations of the calling thread since construction
+class AllocScope {
+public:
+  AllocScope() : start_(threadAllocCounts()) {}
+
+  AllocCounts elapsed() const { return threadAllocCounts() - start_; }
+
+private:
+  AllocCounts start_;
+};
+
+struct PacketAllocStats {
+  uint64_t packets = 0;
+  AllocCounts counts;
+};
+
+// Charge the allocations made while receiving and handling one packet; the
+// network thread records, the debug overlay reads the running totals
+void recordPacketAllocs(const AllocCounts &counts);
+PacketAllocStats packetAllocStats();
+
+} // namespace debug
+} // namespace jetpack
+
+#endif // CLIENT_DEBUG_ALLOC_COUNTER_HPP_
@@ -7,21 +7,17 @@
 */
 
 #include "debug.hpp"
-#include <arpa/inet.h>
-#include <cstring>
+#include "binlog.h"
 #include <ctime>
 #include <filesystem>
-#include <fstream>
+#include <iomanip>
 #include <iostream>
-#include <mutex>
-#include <sys/stat.h>
+#include <sstream>
 
 namespace jetpack {
 namespace debug {
 
-// Static file stream for logging
-static std::ofstream logFile;
-static std::mutex logMutex;
+// Records are handed to the shared async binary logger (common/binlog)
 static bool loggingEnabled = false;
 static std::string logFileName;
 
@@ -35,21 +31,14 @@ bool initLogging(bool debugMode) {
       std::filesystem::create_directory(debugDir);
     }
 
-    logFileName = "debug/client_" + getFileTimestamp() + ".log";
-    logFile.open(logFileName, std::ios::out | std::ios::trunc);
-
-    if (!logFile.is_open()) {
+    logFileName = "debug/client_" + getFileTimestamp() + ".jlog";
+    if (!binlog_open(logFileName.c_str())) {
       std::cerr << "Failed to open log file: " << logFileName << std::endl;
       return false;
     }
 
     loggingEnabled = true;
-
-    logFile << "=======================================" << std::endl;
-    logFile << "Jetpack Client Debug Log" << std::endl;
-    logFile << "Started at: " << getFileTimestamp() << std::endl;
-    logFile << "=======================================" << std::endl;
-
+    logToFile("Main", "Jetpack Client Debug Log started", true);
     return true;
   } catch (const std::exception &e) {
     std::cerr << "Error initializing logging: " << e.what() << std::endl;
@@ -58,46 +47,45 @@ bool initLogging(bool debugMode) {
 }
 
 void shutdownLogging() {
-  if (loggingEnabled && logFile.is_open()) {
-    std::lock_guard<std::mutex> lock(logMutex);
-
-    logFile << "=======================================" << std::endl;
-    logFile << "Logging ended at: " << getFileTimestamp() << std::endl;
-    logFile << "=======================================" << std::endl;
-
-    logFile.close();
-    std::cout << "Debug log written to: " << logFileName << std::endl;
+  if (loggingEnabled) {
+    logToFile("Main", "Logging ended", true);
+    binlog_close();
+    loggingEnabled = false;
+    std::cout << "Debug log written to: " << logFileName
+              << " (decode with jetpack_logdump)" << std::endl;
   }
 }
 
 void print(const std::string &component, const std::string &message,
            bool debugMode) {
   if (debugMode) {
-    std::string timestamp = getTimestamp();
-
-    std::cout << "[" << timestamp << "][" << component << "] " << message
+    std::cout << "[" << getTimestamp() << "][" << component << "] " << message
               << std::endl
               << std::flush;
 
-    if (loggingEnabled && logFile.is_open()) {
-      std::lock_guard<std::mutex> lock(logMutex);
-      logFile << "[" << timestamp << "][" << component << "] " << message
-              << std::endl;
-      logFile.flush();
-    }
+    logToFile(component, message, debugMode);
   }
 }
 
 void logToFile(const std::string &component, const std::string &message,
                bool debugMode) {
-  if (debugMode && loggingEnabled && logFile.is_open()) {
-    std::lock_guard<std::mutex> lock(logMutex);
-    logFile << "[" << getTimestamp() << "][" << component << "] " << message
-            << std::endl;
-    logFile.flush();
+  if (debugMode) {
+    binlog_text(component.c_str(), message.data(), message.size());
   }
 }
 
+void logPacket(const char *component, bool sent, const void *header,
+               size_t headerLen, const std::vector<uint8_t> &payload) {
+  if (!binlog_enabled())
+    return;
+
+  binlog_packet_t packet = {
+      component,      static_cast<uint8_t>(sent ? BINLOG_TX : BINLOG_RX),
+      header,         headerLen,
+      payload.data(), payload.size()};
+  binlog_packet(&packet);
+}
+
 std::string formatHexDump(const std::vector<uint8_t> &data, size_t maxBytes) {
   if (data.empty()) {
     return "<empty>";
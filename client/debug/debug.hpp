@@ -18,8 +18,8 @@ namespace debug {
 
 /**
  * Initialize the logging system
- * Creates a log file in the debug directory with the format:
- * client_[date]_[time].log
+ * Creates a binary log file in the debug directory with the format:
+ * client_[date]_[time].jlog
  */
 bool initLogging(bool debugMode);
 
@@ -35,11 +35,18 @@ void print(const std::string &component, const std::string &message,
            bool debugMode);
 
 /**
- * Log debug message to file only (no console output)
+ * Log debug message to file only (no console output), without blocking on I/O
  */
 void logToFile(const std::string &component, const std::string &message,
                bool debugMode);
 
+/**
+ * Record a raw packet (header + payload) in the binary log; the hex dump is
+ * produced offline by jetpack_logdump
+ */
+void logPacket(const char *component, bool sent, const void *header,
+               size_t headerLen, const std::vector<uint8_t> &payload);
+
 /**
  * Format binary data as hex dump for debugging
  */
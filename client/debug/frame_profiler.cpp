@@ -0,0 +1,193 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Frame profiler implementation
+*/
+
+#include "frame_profiler.hpp"
+#include "trace.hpp"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iomanip>
+
+namespace jetpack {
+namespace debug {
+
+namespace {
+
+// Innermost live timer of the thread, the one countDrawCalls() charges
+thread_local const ScopedTimer *t_activeTimer = nullptr;
+
+float elapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<float, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+} // namespace
+
+FrameProfiler::~FrameProfiler() { stop(); }
+
+bool FrameProfiler::start(const std::string &csvPath) {
+  enabled_ = true;
+  if (csvPath.empty())
+    return true;
+
+  std::error_code error;
+  std::filesystem::path parent = std::filesystem::path(csvPath).parent_path();
+  if (!parent.empty()) {
+    std::filesystem::create_directories(parent, error);
+  }
+
+  csv_.open(csvPath);
+  if (!csv_.is_open())
+    return false;
+  csv_ << "frame";
+  for (size_t i = 0; i < STAGE_COUNT; ++i) {
+    csv_ << "," << stageName(static_cast<FrameStage>(i)) << "_ms";
+  }
+  if (allocTrackingEnabled()) {
+    csv_ << ",allocs,alloc_bytes";
+  }
+  csv_ << "\n" << std::fixed << std::setprecision(3);
+  return true;
+}
+
+void FrameProfiler::stop() {
+  enabled_ = false;
+  if (csv_.is_open()) {
+    csv_.close();
+  }
+}
+
+void FrameProfiler::beginFrame() {
+  if (!enabled_)
+    return;
+  std::fill(current_, current_ + STAGE_COUNT, 0.0f);
+  std::fill(currentDraws_, currentDraws_ + STAGE_COUNT, 0);
+  frameStart_ = std::chrono::steady_clock::now();
+  frameAllocStart_ = threadAllocCounts();
+}
+
+void FrameProfiler::endFrame() {
+  if (!enabled_)
+    return;
+  size_t total = static_cast<size_t>(FrameStage::Total);
+  current_[total] = elapsedMilliseconds(frameStart_);
+  allocHistory_[head_] = threadAllocCounts() - frameAllocStart_;
+  currentDraws_[total] = 0;
+  for (size_t i = 0; i < total; ++i) {
+    currentDraws_[total] += currentDraws_[i];
+  }
+
+  for (size_t i = 0; i < STAGE_COUNT; ++i) {
+    history_[i][head_] = current_[i];
+    drawHistory_[i][head_] = currentDraws_[i];
+  }
+  head_ = (head_ + 1) % HISTORY_FRAMES;
+  filled_ = std::min(filled_ + 1, HISTORY_FRAMES);
+
+  if (csv_.is_open()) {
+    const AllocCounts &allocs = frameAllocs(0);
+
+    csv_ << frameIndex_;
+    for (size_t i = 0; i < STAGE_COUNT; ++i) {
+      csv_ << "," << current_[i];
+    }
+    if (allocTrackingEnabled()) {
+      csv_ << "," << allocs.allocations << "," << allocs.bytes;
+    }
+    csv_ << "\n";
+  }
+  frameIndex_++;
+}
+
+void FrameProfiler::addSample(FrameStage stage, float milliseconds) {
+  current_[static_cast<size_t>(stage)] += milliseconds;
+}
+
+float FrameProfiler::percentile(FrameStage stage, float percent) const {
+  if (filled_ == 0)
+    return 0.0f;
+
+  const float *samples = history_[static_cast<size_t>(stage)];
+  scratch_.assign(samples, samples + filled_);
+  size_t rank = static_cast<size_t>(
+      std::lround(percent / 100.0f * static_cast<float>(filled_ - 1)));
+  std::nth_element(scratch_.begin(), scratch_.begin() + rank, scratch_.end());
+  return scratch_[rank];
+}
+
+float FrameProfiler::sample(FrameStage stage, size_t framesAgo) const {
+  if (framesAgo >= filled_)
+    return 0.0f;
+  size_t slot = (head_ + HISTORY_FRAMES - 1 - framesAgo) % HISTORY_FRAMES;
+  return history_[static_cast<size_t>(stage)][slot];
+}
+
+void FrameProfiler::addDrawCalls(FrameStage stage, uint32_t count) {
+  currentDraws_[static_cast<size_t>(stage)] += count;
+}
+
+uint32_t FrameProfiler::drawCalls(FrameStage stage, size_t framesAgo) const {
+  if (framesAgo >= filled_)
+    return 0;
+  size_t slot = (head_ + HISTORY_FRAMES - 1 - framesAgo) % HISTORY_FRAMES;
+  return drawHistory_[static_cast<size_t>(stage)][slot];
+}
+
+const AllocCounts &FrameProfiler::frameAllocs(size_t framesAgo) const {
+  static const AllocCounts none;
+
+  if (framesAgo >= filled_)
+    return none;
+  size_t slot = (head_ + HISTORY_FRAMES - 1 - framesAgo) % HISTORY_FRAMES;
+  return allocHistory_[slot];
+}
+
+const char *FrameProfiler::stageName(FrameStage stage) {
+  static const char *names[STAGE_COUNT] = {
+      "events", "camera", "map", "players", "upscale", "ui", "display",
+      "total"};
+
+  size_t index = static_cast<size_t>(stage);
+  return index < STAGE_COUNT ? names[index] : "unknown";
+}
+
+void countDrawCalls(uint32_t count) {
+  const ScopedTimer *timer = t_activeTimer;
+
+  if (timer) {
+    timer->profiler_->addDrawCalls(timer->stage_, count);
+  }
+}
+
+ScopedTimer::ScopedTimer(FrameProfiler *profiler, FrameStage stage)
+    : profiler_((profiler && profiler->isEnabled()) ? profiler : nullptr),
+      stage_(stage),
+      traceName_(isTracing() ? FrameProfiler::stageName(stage) : nullptr),
+      outer_(t_activeTimer) {
+  if (traceName_) {
+    detail::traceBegin(traceName_, "render");
+  }
+  if (profiler_) {
+    t_activeTimer = this;
+    start_ = std::chrono::steady_clock::now();
+  }
+}
+
+ScopedTimer::~ScopedTimer() {
+  if (profiler_) {
+    profiler_->addSample(stage_, elapsedMilliseconds(start_));
+    t_activeTimer = outer_;
+  }
+  if (traceName_) {
+    detail::traceEnd(traceName_, "render");
+  }
+}
+
+} // namespace debug
+} // namespace jetpack
@@ -0,0 +1,119 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Per-stage frame timing with a rolling window and CSV export
+*/
+
+#ifndef CLIENT_DEBUG_FRAME_PROFILER_HPP_
+#define CLIENT_DEBUG_FRAME_PROFILER_HPP_
+
+#include "alloc_counter.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace debug {
+
+enum class FrameStage : uint8_t {
+  Events = 0,
+  Camera,
+  Map,
+  Players,
+  Upscale,
+  Ui,
+  Display,
+  Total, // Whole frame, from beginFrame() to endFrame()
+  Count
+};
+
+class FrameProfiler {
+public:
+  static constexpr size_t HISTORY_FRAMES = 240; // About 4 s at 60 FPS
+  static constexpr size_t STAGE_COUNT = static_cast<size_t>(FrameStage::Count);
+
+  FrameProfiler() = default;
+  ~FrameProfiler();
+
+  // Start recording; one CSV row per frame is written to csvPath when it is
+  // not empty
+  bool start(const std::string &csvPath);
+  void stop();
+  bool isEnabled() const { return enabled_; }
+
+  void beginFrame();
+  void endFrame();
+
+  // Add time spent in a stage during the current frame
+  void addSample(FrameStage stage, float milliseconds);
+
+  // Percentile (0-100) of a stage over the rolling window
+  float percentile(FrameStage stage, float percent) const;
+
+  // Time of a stage framesAgo completed frames back (0 = last frame)
+  float sample(FrameStage stage, size_t framesAgo) const;
+
+  // Draw calls issued by a stage during the current frame; Total is the sum
+  // of the other stages
+  void addDrawCalls(FrameStage stage, uint32_t count);
+  uint32_t drawCalls(FrameStage stage, size_t framesAgo) const;
+
+  // Allocations of the frame thread between beginFrame() and endFrame(),
+  // zero unless built with JETPACK_ALLOC_TRACKING
+  const AllocCounts &frameAllocs(size_t framesAgo) const;
+
+  // Number of frames currently held in the window
+  size_t frameCount() const { return filled_; }
+
+  static const char *stageName(FrameStage stage);
+
+private:
+  bool enabled_ = false;
+  std::chrono::steady_clock::time_point frameStart_;
+  float current_[STAGE_COUNT] = {};
+  float history_[STAGE_COUNT][HISTORY_FRAMES] = {};
+  uint32_t currentDraws_[STAGE_COUNT] = {};
+  uint32_t drawHistory_[STAGE_COUNT][HISTORY_FRAMES] = {};
+  AllocCounts frameAllocStart_;
+  AllocCounts allocHistory_[HISTORY_FRAMES] = {};
+  size_t head_ = 0; // Next slot to write
+  size_t filled_ = 0;
+  uint64_t frameIndex_ = 0;
+  std::ofstream csv_;
+  mutable std::vector<float> scratch_;
+};
+
+// Charge draw calls to the innermost ScopedTimer of this thread; does
+// nothing outside a timed stage or when profiling is off
+void countDrawCalls(uint32_t count = 1);
+
+// Adds the lifetime of the scope to a stage, and records it as a trace span
+// while tracing; does nothing when the profiler is null or disabled and no
+// trace is running
+class ScopedTimer {
+public:
+  ScopedTimer(FrameProfiler *profiler, FrameStage stage);
+  ~ScopedTimer();
+
+  ScopedTimer(const ScopedTimer &) = delete;
+  ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+private:
+  friend void countDrawCalls(uint32_t count);
+
+  FrameProfiler *profiler_;
+  FrameStage stage_;
+  const char *traceName_;
+  std::chrono::steady_clock::time_point start_;
+  const ScopedTimer *outer_; // Restored as the draw call target on exit
+};
+
+} // namespace debug
+} // namespace jetpack
+
+#endif // CLIENT_DEBUG_FRAME_PROFILER_HPP_
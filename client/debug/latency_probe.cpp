@@ -0,0 +1,74 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Input-to-photon probe implementation
+*/
+
+#include "latency_probe.hpp"
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+
+namespace jetpack {
+namespace debug {
+
+namespace detail {
+std::atomic<bool> probing(false);
+} // namespace detail
+
+namespace {
+
+// A few events per input change and one per displayed tick, so a shared
+// file behind a mutex is enough
+std::mutex probeMutex;
+FILE *probeFile = nullptr;
+
+} // namespace
+
+bool startLatencyProbe(const std::string &path) {
+  std::lock_guard<std::mutex> lock(probeMutex);
+
+  if (probeFile)
+    return true;
+  probeFile = fopen(path.c_str(), "w");
+  if (!probeFile)
+    return false;
+  fputs("event,player,value,tick,time_ns\n", probeFile);
+  detail::probing.store(true, std::memory_order_release);
+  return true;
+}
+
+void stopLatencyProbe() {
+  std::lock_guard<std::mutex> lock(probeMutex);
+
+  detail::probing.store(false, std::memory_order_release);
+  if (probeFile) {
+    fclose(probeFile);
+    probeFile = nullptr;
+  }
+}
+
+uint64_t probeNow() {
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL +
+         static_cast<uint64_t>(now.tv_nsec);
+}
+
+void probeEvent(const char *event, int player, int value, uint32_t tick) {
+  uint64_t now = probeNow();
+  std::lock_guard<std::mutex> lock(probeMutex);
+
+  if (!probeFile)
+    return;
+  fprintf(probeFile, "%s,%d,%d,%u,%llu\n", event, player, value, tick,
+          static_cast<unsigned long long>(now));
+  // The client may be killed by the harness, keep every line on disk
+  fflush(probeFile);
+}
+
+} // namespace debug
+} // namespace jetpack
@@ -0,0 +1,54 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Opt-in input-to-photon probes for the client threads
+*/
+
+#ifndef CLIENT_DEBUG_LATENCY_PROBE_HPP_
+#define CLIENT_DEBUG_LATENCY_PROBE_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace jetpack {
+namespace debug {
+
+namespace detail {
+extern std::atomic<bool> probing;
+} // namespace detail
+
+/**
+ * Start writing probe events as CSV lines (event,player,value,tick,time_ns),
+ * the format of jetpack_server -L so jetpack_latency can match both files
+ */
+bool startLatencyProbe(const std::string &path);
+
+/**
+ * Flush and close the probe file
+ */
+void stopLatencyProbe();
+
+/**
+ * Check whether probe events are currently recorded
+ */
+inline bool isProbing() {
+  return detail::probing.load(std::memory_order_relaxed);
+}
+
+/**
+ * CLOCK_MONOTONIC in nanoseconds, the clock of the server probes
+ */
+uint64_t probeNow();
+
+/**
+ * Record one event stamped with probeNow(). Names must be string literals.
+ */
+void probeEvent(const char *event, int player, int value, uint32_t tick);
+
+} // namespace debug
+} // namespace jetpack
+
+#endif // CLIENT_DEBUG_LATENCY_PROBE_HPP_
@@ -0,0 +1,37 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Level-gated logging implementation for Jetpack client
+*/
+
+#include "log.hpp"
+#include "debug.hpp"
+#include <iostream>
+
+namespace jetpack {
+namespace debug {
+
+namespace detail {
+std::atomic<uint8_t> logThreshold(static_cast<uint8_t>(Level::Error));
+} // namespace detail
+
+void setLogLevel(Level level) {
+  detail::logThreshold.store(static_cast<uint8_t>(level),
+                             std::memory_order_relaxed);
+}
+
+void write(Level level, const char *component, const std::string &message) {
+  if (level >= Level::Error) {
+    std::cerr << "Error: " << message << std::endl;
+    logToFile(component, message, true);
+  } else if (level >= Level::Info) {
+    print(component, message, true);
+  } else {
+    logToFile(component, message, true);
+  }
+}
+
+} // namespace debug
+} // namespace jetpack
@@ -0,0 +1,122 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Level-gated logging macros for Jetpack client
+*/
+
+#ifndef CLIENT_DEBUG_LOG_HPP_
+#define CLIENT_DEBUG_LOG_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+// Records below this level are removed at compile time
+// (0 = trace, 1 = debug, 2 = info, 3 = warn, 4 = error, 5 = off)
+#ifndef JETPACK_LOG_MIN_LEVEL
+#define JETPACK_LOG_MIN_LEVEL 0
+#endif
+
+namespace jetpack {
+namespace debug {
+
+enum class Level : uint8_t {
+  Trace = 0, // Per-packet / per-player detail, file only
+  Debug = 1, // Protocol events, file only
+  Info = 2,  // Console and file
+  Warn = 3,
+  Error = 4,
+  Off = 5
+};
+
+namespace detail {
+extern std::atomic<uint8_t> logThreshold;
+} // namespace detail
+
+/**
+ * Set the lowest level that reaches a sink at runtime
+ */
+void setLogLevel(Level level);
+
+/**
+ * Check whether a record at this level would reach a sink
+ */
+inline bool isEnabled(Level level) {
+  return static_cast<uint8_t>(level) >=
+         detail::logThreshold.load(std::memory_order_relaxed);
+}
+
+/**
+ * Emit an already formatted record. Errors go to stderr as "Error: ...",
+ * Info and Warn are echoed to stdout, lower levels are written to the log
+ * file only. Errors reach a sink unless the level was set to Off.
+ */
+void write(Level level, const char *component, const std::string &message);
+
+} // namespace debug
+} // namespace jetpack
+
+// The streamed expression is only evaluated once the level is known to
+// reach a sink, so disabled records cost a single relaxed load.
+#define JETPACK_LOG_AT(level, component, expr)                                 \
+  do {                                                                         \
+    if (::jetpack::debug::isEnabled(level)) {                                  \
+      std::ostringstream jetpackLogStream_;                                    \
+      jetpackLogStream_ << expr;                                               \
+      ::jetpack::debug::write(level, component, jetpackLogStream_.str());      \
+    }                                                                          \
+  } while (0)
+
+// Compiled-out records still type-check their arguments (and keep variables
+// only used for logging referenced) but generate no code.
+#define JETPACK_LOG_DISCARD(level, component, expr)                            \
+  do {                                                                         \
+    if (false) {                                                               \
+      JETPACK_LOG_AT(level, component, expr);                                  \
+    }                                                                          \
+  } while (0)
+
+#if JETPACK_LOG_MIN_LEVEL <= 0
+#define JETPACK_LOG_TRACE(component, expr)                                     \
+  JETPACK_LOG_AT(::jetpack::debug::Level::Trace, component, expr)
+#else
+#define JETPACK_LOG_TRACE(component, expr)                                     \
+  JETPACK_LOG_DISCARD(::jetpack::debug::Level::Trace, component, expr)
+#endif
+
+#if JETPACK_LOG_MIN_LEVEL <= 1
+#define JETPACK_LOG_DEBUG(component, expr)                                     \
+  JETPACK_LOG_AT(::jetpack::debug::Level::Debug, component, expr)
+#else
+#define JETPACK_LOG_DEBUG(component, expr)                                     \
+  JETPACK_LOG_DISCARD(::jetpack::debug::Level::Debug, component, expr)
+#endif
+
+#if JETPACK_LOG_MIN_LEVEL <= 2
+#define JETPACK_LOG_INFO(component, expr)                                      \
+  JETPACK_LOG_AT(::jetpack::debug::Level::Info, component, expr)
+#else
+#define JETPACK_LOG_INFO(component, expr)                                      \
+  JETPACK_LOG_DISCARD(::jetpack::debug::Level::Info, component, expr)
+#endif
+
+#if JETPACK_LOG_MIN_LEVEL <= 3
+#define JETPACK_LOG_WARN(component, expr)                                      \
+  JETPACK_LOG_AT(::jetpack::debug::Level::Warn, component, expr)
+#else
+#define JETPACK_LOG_WARN(component, expr)                                      \
+  JETPACK_LOG_DISCARD(::jetpack::debug::Level::Warn, component, expr)
+#endif
+
+#if JETPACK_LOG_MIN_LEVEL <= 4
+#define JETPACK_LOG_ERROR(component, expr)                                     \
+  JETPACK_LOG_AT(::jetpack::debug::Level::Error, component, expr)
+#else
+#define JETPACK_LOG_ERROR(component, expr)                                     \
+  JETPACK_LOG_DISCARD(::jetpack::debug::Level::Error, component, expr)
+#endif
+
+#endif // CLIENT_DEBUG_LOG_HPP_
@@ -0,0 +1,172 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Chrome trace-event recorder implementation
+*/
+
+#include "trace.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace jetpack {
+namespace debug {
+
+namespace detail {
+std::atomic<bool> tracing(false);
+} // namespace detail
+
+namespace {
+
+// Events kept per thread before further spans are dropped: 2^20 events of
+// 32 bytes (phase is padded to 8), so up to 32 MiB per traced thread
+constexpr size_t MAX_EVENTS_PER_THREAD = 1 << 20;
+
+struct TraceEvent {
+  const char *name;
+  const char *category;
+  char phase; // 'B' or 'E'
+  int64_t nanoseconds;
+};
+
+static_assert(sizeof(TraceEvent) * MAX_EVENTS_PER_THREAD <= (32u << 20),
+              "update the per-thread trace memory figure above");
+
+// Each thread appends to its own buffer; the lock is only contended while
+// the file is written
+struct ThreadBuffer {
+  std::mutex mutex;
+  int tid;
+  std::string name;
+  std::vector<TraceEvent> events;
+  size_t dropped = 0;
+  size_t droppedDepth = 0; // Open spans whose begin was dropped
+};
+
+std::mutex registryMutex;
+std::vector<std::unique_ptr<ThreadBuffer>> registry;
+std::chrono::steady_clock::time_point traceStart;
+std::string tracePath;
+
+ThreadBuffer &threadBuffer() {
+  thread_local ThreadBuffer *buffer = nullptr;
+
+  if (!buffer) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    registry.push_back(std::make_unique<ThreadBuffer>());
+    buffer = registry.back().get();
+    buffer->tid = static_cast<int>(registry.size());
+    buffer->events.reserve(4096);
+  }
+  return *buffer;
+}
+
+void record(const char *name, const char *category, char phase) {
+  int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - traceStart)
+                    .count();
+  ThreadBuffer &buffer = threadBuffer();
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+
+  // Spans nest, so the end of a dropped begin is the next end seen while
+  // droppedDepth is non-zero; skipping it keeps the stream balanced
+  if (phase == 'B' && buffer.events.size() >= MAX_EVENTS_PER_THREAD) {
+    buffer.dropped++;
+    buffer.droppedDepth++;
+    return;
+  }
+  if (phase == 'E' && buffer.droppedDepth > 0) {
+    buffer.droppedDepth--;
+    return;
+  }
+  buffer.events.push_back({name, category, phase, now});
+}
+
+void writeEscaped(FILE *file, const std::string &text) {
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      fputc('\\', file);
+    }
+    fputc(c, file);
+  }
+}
+
+} // namespace
+
+namespace detail {
+
+void traceBegin(const char *name, const char *category) {
+  record(name, category, 'B');
+}
+
+void traceEnd(const char *name, const char *category) {
+  record(name, category, 'E');
+}
+
+} // namespace detail
+
+bool startTrace(const std::string &path) {
+  FILE *probe = fopen(path.c_str(), "w");
+  if (!probe)
+    return false;
+  fclose(probe);
+
+  tracePath = path;
+  traceStart = std::chrono::steady_clock::now();
+  detail::tracing.store(true, std::memory_order_release);
+  return true;
+}
+
+void stopTrace() {
+  if (!detail::tracing.exchange(false))
+    return;
+
+  FILE *file = fopen(tracePath.c_str(), "w");
+  if (!file)
+    return;
+
+  std::lock_guard<std::mutex> registryLock(registryMutex);
+  bool first = true;
+  fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+  for (auto &buffer : registry) {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    if (!buffer->name.empty()) {
+      fprintf(file,
+              "%s\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,"
+              "\"tid\":%d,\"args\":{\"name\":\"",
+              first ? "" : ",", buffer->tid);
+      writeEscaped(file, buffer->name);
+      fputs("\"}}", file);
+      first = false;
+    }
+    for (const auto &event : buffer->events) {
+      fprintf(file,
+              "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\","
+              "\"ts\":%lld.%03lld,\"pid\":1,\"tid\":%d}",
+              first ? "" : ",", event.name, event.category, event.phase,
+              static_cast<long long>(event.nanoseconds / 1000),
+              static_cast<long long>(event.nanoseconds % 1000), buffer->tid);
+      first = false;
+    }
+    if (buffer->dropped > 0) {
+      fprintf(stderr, "Trace: dropped %zu spans on thread %d\n",
+              buffer->dropped, buffer->tid);
+    }
+    buffer->events.clear();
+  }
+  fputs("\n]}\n", file);
+  fclose(file);
+}
+
+void setTraceThreadName(const char *name) {
+  ThreadBuffer &buffer = threadBuffer();
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+  buffer.name = name;
+}
+
+} // namespace debug
+} // namespace jetpack
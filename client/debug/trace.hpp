@@ -0,0 +1,96 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Opt-in Chrome trace-event recorder for the client threads
+*/
+
+#ifndef CLIENT_DEBUG_TRACE_HPP_
+#define CLIENT_DEBUG_TRACE_HPP_
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace jetpack {
+namespace debug {
+
+namespace detail {
+extern std::atomic<bool> tracing;
+void traceBegin(const char *name, const char *category);
+void traceEnd(const char *name, const char *category);
+} // namespace detail
+
+/**
+ * Start recording spans; the Chrome trace JSON is written to path by
+ * stopTrace(), once every traced thread has been joined
+ */
+bool startTrace(const std::string &path);
+
+/**
+ * Stop recording and write the trace file (loads in Perfetto or
+ * chrome://tracing)
+ */
+void stopTrace();
+
+/**
+ * Check whether spans are currently recorded
+ */
+inline bool isTracing() {
+  return detail::tracing.load(std::memory_order_relaxed);
+}
+
+/**
+ * Name the calling thread in the trace
+ */
+void setTraceThreadName(const char *name);
+
+// Records a begin/end span around its scope. Names must be string
+// literals: only the pointer is stored.
+class TraceSpan {
+public:
+  explicit TraceSpan(const char *name, const char *category = "client")
+      : name_(isTracing() ? name : nullptr), category_(category) {
+    if (name_)
+      detail::traceBegin(name_, category_);
+  }
+  ~TraceSpan() {
+    if (name_)
+      detail::traceEnd(name_, category_);
+  }
+
+  TraceSpan(const TraceSpan &) = delete;
+  TraceSpan &operator=(const TraceSpan &) = delete;
+
+private:
+  const char *name_;
+  const char *category_;
+};
+
+// std::lock_guard replacement that records a "lock" span for the time
+// spent waiting when the mutex was already held by another thread
+class TracedLock {
+public:
+  TracedLock(std::mutex &mutex, const char *name) : mutex_(mutex) {
+    if (!isTracing()) {
+      mutex_.lock();
+    } else if (!mutex_.try_lock()) {
+      detail::traceBegin(name, "lock");
+      mutex_.lock();
+      detail::traceEnd(name, "lock");
+    }
+  }
+  ~TracedLock() { mutex_.unlock(); }
+
+  TracedLock(const TracedLock &) = delete;
+  TracedLock &operator=(const TracedLock &) = delete;
+
+private:
+  std::mutex &mutex_;
+};
+
+} // namespace debug
+} // namespace jetpack
+
+#endif // CLIENT_DEBUG_TRACE_HPP_
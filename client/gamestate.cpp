@@ -7,122 +7,169 @@
 */
 
 #include "gamestate.hpp"
+#include "debug/trace.hpp"
 
 namespace jetpack {
 
 void GameState::setConnected(bool status) { connected = status; }
 
 void GameState::setAssignedId(uint8_t id) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   assignedId = id;
 }
 
 void GameState::setGameRunning(bool running) { gameRunning = running; }
 
 void GameState::setJetpackActive(bool active) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   jetpackActive = active;
 }
 
 void GameState::setMapDimensions(uint16_t width, uint16_t height) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   mapWidth = width;
   mapHeight = height;
   mapData.resize(width * height, protocol::EMPTY);
+  mapRevision++;
+  coinsCollectedByLocalPlayer.resize(width, height);
+  coinsCollectedByOtherPlayers.resize(width, height);
+  coinRevision++;
 }
 
 void GameState::addMapChunk(const std::vector<uint8_t> &chunkData) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   mapData.insert(mapData.end(), chunkData.begin(), chunkData.end());
+  mapRevision++;
 }
 
 void GameState::setMapData(const std::vector<uint8_t> &data) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   mapData = data;
+  mapRevision++;
 }
 
 void GameState::setPlayerStates(
     const std::vector<protocol::PlayerState> &states) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   playerStates = states;
 }
 
 void GameState::setCurrentTick(uint32_t tick) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   currentTick = tick;
 }
 
 void GameState::setGameEnded(bool ended, uint8_t winId) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   gameEnded = ended;
   winnerId = winId;
 }
 
-void GameState::addCollectedCoinByLocalPlayer(uint16_t tileX, uint16_t tileY) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  coinsCollectedByLocalPlayer.insert({tileX, tileY});
+void GameState::applyCoinEvents(
+    const std::vector<protocol::CoinEvent> &events) {
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
+  bool changed = false;
+
+  for (const auto &event : events) {
+    CoinBitmap &owner = (event.collectorId == assignedId)
+                            ? coinsCollectedByLocalPlayer
+                            : coinsCollectedByOtherPlayers;
+    changed |= owner.setIndex(event.coinId);
+  }
+  if (changed)
+    coinRevision++;
 }
 
-void GameState::addCollectedCoinByOtherPlayer(uint16_t tileX, uint16_t tileY) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  coinsCollectedByOtherPlayers.insert({tileX, tileY});
+void GameState::clearCoins() {
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
+  coinsCollectedByLocalPlayer.resize(mapWidth, mapHeight);
+  coinsCollectedByOtherPlayers.resize(mapWidth, mapHeight);
+  coinRevision++;
 }
 
 bool GameState::isCoinCollectedByLocalPlayer(uint16_t tileX,
                                              uint16_t tileY) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return coinsCollectedByLocalPlayer.find({tileX, tileY}) !=
-         coinsCollectedByLocalPlayer.end();
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
+  return coinsCollectedByLocalPlayer.test(tileX, tileY);
 }
 
 bool GameState::isCoinCollectedByOtherPlayer(uint16_t tileX,
                                              uint16_t tileY) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return coinsCollectedByOtherPlayers.find({tileX, tileY}) !=
-         coinsCollectedByOtherPlayers.end();
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
+  return coinsCollectedByOtherPlayers.test(tileX, tileY);
+}
+
+bool GameState::getCoinSnapshot(CoinSnapshot *snapshot) const {
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
+  if (snapshot->revision == coinRevision)
+    return false;
+  snapshot->revision = coinRevision;
+  snapshot->local = coinsCollectedByLocalPlayer;
+  snapshot->other = coinsCollectedByOtherPlayers;
+  return true;
+}
+
+void GameState::getSnapshot(GameSnapshot *snapshot) const {
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
+  snapshot->connected = connected;
+  snapshot->assignedId = assignedId;
+  snapshot->gameRunning = gameRunning;
+  snapshot->jetpackActive = jetpackActive;
+  snapshot->mapWidth = mapWidth;
+  snapshot->mapHeight = mapHeight;
+  snapshot->mapRevision = mapRevision;
+  snapshot->currentTick = currentTick;
+  snapshot->gameEnded = gameEnded;
+  snapshot->winnerId = winnerId;
+  snapshot->players.assign(playerStates.begin(), playerStates.end());
 }
 
 bool GameState::isConnected() const { return connected; }
 
 uint8_t GameState::getAssignedId() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   return assignedId;
 }
 
 bool GameState::isGameRunning() const { return gameRunning; }
 
 bool GameState::isJetpackActive() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   return jetpackActive;
 }
 
 std::pair<uint16_t, uint16_t> GameState::getMapDimensions() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   return {mapWidth, mapHeight};
 }
 
 std::vector<uint8_t> GameState::getMapData() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   return mapData;
 }
 
 std::vector<protocol::PlayerState> GameState::getPlayerStates() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   return playerStates;
 }
 
+uint32_t GameState::getMapRevision() const {
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
+  return mapRevision;
+}
+
 uint32_t GameState::getCurrentTick() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   return currentTick;
 }
 
 bool GameState::hasGameEnded() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   return gameEnded;
 }
 
 uint8_t GameState::getWinnerId() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+  debug::TracedLock lock(mutex_, "GameState::mutex_");
   return winnerId;
 }
 
@@ -9,21 +9,36 @@
 #ifndef CLIENT_GAMESTATE_HPP_
 #define CLIENT_GAMESTATE_HPP_
 
+#include "coin_bitmap.hpp"
 #include "protocol.hpp"
 #include <atomic>
 #include <mutex>
-#include <set>
 #include <utility>
 #include <vector>
 
 namespace jetpack {
 
+// Everything one rendered frame reads, copied under a single lock
+struct GameSnapshot {
+  bool connected = false;
+  uint8_t assignedId = 0;
+  bool gameRunning = false;
+  bool jetpackActive = false;
+  uint16_t mapWidth = 0;
+  uint16_t mapHeight = 0;
+  uint32_t mapRevision = 0;
+  uint32_t currentTick = 0;
+  bool gameEnded = false;
+  uint8_t winnerId = protocol::NO_WINNER;
+  std::vector<protocol::PlayerState> players;
+};
+
 class GameState {
 public:
   GameState()
       : connected(false), assignedId(0), gameRunning(false),
-        jetpackActive(false), mapWidth(0), mapHeight(0), currentTick(0),
-        gameEnded(false), winnerId(0xFF) {}
+        jetpackActive(false), mapWidth(0), mapHeight(0), mapRevision(0),
+        currentTick(0), coinRevision(0), gameEnded(false), winnerId(0xFF) {}
 
   // Thread-safe setters
   void setConnected(bool status);
@@ -36,8 +51,10 @@ public:
   void setPlayerStates(const std::vector<protocol::PlayerState> &states);
   void setCurrentTick(uint32_t tick);
   void setGameEnded(bool ended, uint8_t winnerId);
-  void addCollectedCoinByLocalPlayer(uint16_t tileX, uint16_t tileY);
-  void addCollectedCoinByOtherPlayer(uint16_t tileX, uint16_t tileY);
+  // Mark the coins of a COIN_EVENT batch under a single lock
+  void applyCoinEvents(const std::vector<protocol::CoinEvent> &events);
+  // Forget every collected coin (replay seeking)
+  void clearCoins();
 
   // Thread-safe getters
   bool isConnected() const;
@@ -46,6 +63,7 @@ public:
   bool isJetpackActive() const;
   std::pair<uint16_t, uint16_t> getMapDimensions() const;
   std::vector<uint8_t> getMapData() const;
+  uint32_t getMapRevision() const;
   std::vector<protocol::PlayerState> getPlayerStates() const;
   uint32_t getCurrentTick() const;
   bool hasGameEnded() const;
@@ -53,6 +71,14 @@ public:
   bool isCoinCollectedByLocalPlayer(uint16_t tileX, uint16_t tileY) const;
   bool isCoinCollectedByOtherPlayer(uint16_t tileX, uint16_t tileY) const;
 
+  // Copy both coin bitmaps into snapshot unless it already holds the
+  // current revision; returns true when a copy was made
+  bool getCoinSnapshot(CoinSnapshot *snapshot) const;
+
+  // Fill snapshot with the current state; its player vector is reused so
+  // steady-state calls do not allocate
+  void getSnapshot(GameSnapshot *snapshot) const;
+
 private:
   mutable std::mutex mutex_;
   std::atomic<bool> connected;
@@ -64,14 +90,16 @@ private:
   uint16_t mapWidth;
   uint16_t mapHeight;
   std::vector<uint8_t> mapData;
+  uint32_t mapRevision; // Bumped whenever the map layout changes
 
   // Player states
   std::vector<protocol::PlayerState> playerStates;
   uint32_t currentTick;
 
-  // Collected coins positions (tileX, tileY)
-  std::set<std::pair<uint16_t, uint16_t>> coinsCollectedByLocalPlayer;
-  std::set<std::pair<uint16_t, uint16_t>> coinsCollectedByOtherPlayers;
+  // Collected coins, one bit per tile, sized with the map
+  CoinBitmap coinsCollectedByLocalPlayer;
+  CoinBitmap coinsCollectedByOtherPlayers;
+  uint32_t coinRevision;
 
   // Game end state
   bool gameEnded;
@@ -0,0 +1,123 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Dynamic resolution scaling implementation
+*/
+
+#include "dynamic_resolution.hpp"
+#include "../debug/frame_profiler.hpp"
+#include "../debug/log.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace jetpack {
+namespace graphics {
+
+namespace {
+
+constexpr float MIN_SCALE = 0.5f;
+constexpr float MAX_SCALE = 1.0f;
+constexpr float SCALE_STEP = 0.125f;
+constexpr float AVERAGE_WEIGHT = 0.1f;
+
+// Hysteresis: drop a step when frames run 20% over budget, try a step up
+// again only while frames hold the budget
+constexpr float SLOW_RATIO = 1.2f;
+constexpr float FAST_RATIO = 1.05f;
+constexpr unsigned int CHANGE_COOLDOWN_FRAMES = 30;
+constexpr unsigned int UPSCALE_COOLDOWN_FRAMES = 120;
+constexpr unsigned int MAX_UPSCALE_COOLDOWN_FRAMES = 1920;
+
+} // namespace
+
+DynamicResolution::DynamicResolution(float targetFrameSeconds)
+    : targetFrameSeconds_(targetFrameSeconds),
+      upscaleCooldown_(UPSCALE_COOLDOWN_FRAMES) {}
+
+void DynamicResolution::update(float frameSeconds) {
+  if (fixed_)
+    return;
+  if (averageFrameSeconds_ == 0.0f) {
+    averageFrameSeconds_ = frameSeconds;
+  } else {
+    averageFrameSeconds_ +=
+        AVERAGE_WEIGHT * (frameSeconds - averageFrameSeconds_);
+  }
+
+  if (++framesSinceChange_ < CHANGE_COOLDOWN_FRAMES)
+    return;
+
+  if (averageFrameSeconds_ > targetFrameSeconds_ * SLOW_RATIO &&
+      scale_ > MIN_SCALE) {
+    // Going straight back down after a step up means that step was too
+    // optimistic, so wait longer before trying it again
+    if (lastChangeWasUp_) {
+      upscaleCooldown_ =
+          std::min(upscaleCooldown_ * 2, MAX_UPSCALE_COOLDOWN_FRAMES);
+    }
+    scale_ = std::max(MIN_SCALE, scale_ - SCALE_STEP);
+    lastChangeWasUp_ = false;
+  } else if (averageFrameSeconds_ < targetFrameSeconds_ * FAST_RATIO &&
+             scale_ < MAX_SCALE && framesSinceChange_ >= upscaleCooldown_) {
+    scale_ = std::min(MAX_SCALE, scale_ + SCALE_STEP);
+    lastChangeWasUp_ = true;
+  } else {
+    return;
+  }
+
+  framesSinceChange_ = 0;
+  JETPACK_LOG_DEBUG("Renderer", "Render scale "
+                                    << scale_ * 100.0f << "% (average frame "
+                                    << averageFrameSeconds_ * 1000.0f
+                                    << " ms)");
+}
+
+void DynamicResolution::setFixedScale(float scale) {
+  scale_ = std::min(MAX_SCALE, std::max(MIN_SCALE, scale));
+  fixed_ = true;
+}
+
+sf::RenderTarget *DynamicResolution::begin(const sf::IntRect &viewport) {
+  if (!available_ || scale_ >= MAX_SCALE || viewport.width <= 0 ||
+      viewport.height <= 0)
+    return nullptr;
+
+  long width = std::max(1L, std::lround(viewport.width * scale_));
+  long height = std::max(1L, std::lround(viewport.height * scale_));
+  sf::Vector2u size(static_cast<unsigned int>(width),
+                    static_cast<unsigned int>(height));
+
+  if (size != textureSize_) {
+    if (!texture_.create(size.x, size.y)) {
+      JETPACK_LOG_WARN("Renderer", "Offscreen target unavailable, rendering "
+                                   "at full resolution");
+      available_ = false;
+      return nullptr;
+    }
+    texture_.setSmooth(true);
+    textureSize_ = size;
+    sprite_.setTexture(texture_.getTexture(), true);
+  }
+
+  viewport_ = viewport;
+  return &texture_;
+}
+
+void DynamicResolution::present(sf::RenderTarget &window,
+                                const sf::Vector2u &windowSize) {
+  texture_.display();
+  sprite_.setPosition(static_cast<float>(viewport_.left),
+                      static_cast<float>(viewport_.top));
+  sprite_.setScale(static_cast<float>(viewport_.width) / textureSize_.x,
+                   static_cast<float>(viewport_.height) / textureSize_.y);
+
+  window.setView(sf::View(sf::FloatRect(0, 0, static_cast<float>(windowSize.x),
+                                        static_cast<float>(windowSize.y))));
+  window.draw(sprite_);
+  debug::countDrawCalls();
+}
+
+} // namespace graphics
+} // namespace jetpack
@@ -0,0 +1,58 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Offscreen world target whose resolution follows the frame time
+*/
+
+#ifndef CLIENT_GRAPHICS_DYNAMIC_RESOLUTION_HPP_
+#define CLIENT_GRAPHICS_DYNAMIC_RESOLUTION_HPP_
+
+#include <SFML/Graphics.hpp>
+
+namespace jetpack {
+namespace graphics {
+
+class DynamicResolution {
+public:
+  explicit DynamicResolution(float targetFrameSeconds);
+  ~DynamicResolution() = default;
+
+  // Feed the duration of the last frame; may step the scale up or down
+  void update(float frameSeconds);
+
+  // Fraction of the window resolution the world is rendered at
+  float getScale() const { return scale_; }
+
+  // Pin the scale, update() then leaves it alone (benchmarks)
+  void setFixedScale(float scale);
+
+  // Prepare the offscreen target for a viewport of this many window
+  // pixels. Returns nullptr at full scale or when render textures are not
+  // supported, in which case the world is drawn straight to the window.
+  sf::RenderTarget *begin(const sf::IntRect &viewport);
+
+  // Upscale the finished offscreen image into the window viewport
+  void present(sf::RenderTarget &window, const sf::Vector2u &windowSize);
+
+private:
+  const float targetFrameSeconds_;
+  float averageFrameSeconds_ = 0.0f; // Exponential moving average
+  float scale_ = 1.0f;
+  unsigned int framesSinceChange_ = 0;
+  unsigned int upscaleCooldown_;
+  bool lastChangeWasUp_ = false;
+  bool fixed_ = false;
+
+  bool available_ = true;
+  sf::RenderTexture texture_;
+  sf::Vector2u textureSize_;
+  sf::IntRect viewport_;
+  sf::Sprite sprite_;
+};
+
+} // namespace graphics
+} // namespace jetpack
+
+#endif // CLIENT_GRAPHICS_DYNAMIC_RESOLUTION_HPP_
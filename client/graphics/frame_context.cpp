@@ -0,0 +1,34 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Per-frame render context implementation
+*/
+
+#include "frame_context.hpp"
+
+namespace jetpack {
+namespace graphics {
+
+void FrameContext::update(const GameState &gameState, float tileSize) {
+  gameState.getSnapshot(&state);
+
+  mapTotalWidth = state.mapWidth * tileSize;
+  mapTotalHeight = state.mapHeight * tileSize;
+  serverToDisplayX_ = mapTotalWidth / 1000.0f;
+  serverToDisplayY_ = mapTotalHeight / 1000.0f;
+
+  playerPositions.clear();
+  localPlayer = -1;
+  for (size_t i = 0; i < state.players.size(); i++) {
+    const auto &player = state.players[i];
+    playerPositions.push_back(toDisplay(player.posX, player.posY));
+    if (player.id == state.assignedId) {
+      localPlayer = static_cast<int>(i);
+    }
+  }
+}
+
+} // namespace graphics
+} // namespace jetpack
@@ -0,0 +1,53 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Per-frame view of the game state shared by the render stages
+*/
+
+#ifndef CLIENT_GRAPHICS_FRAME_CONTEXT_HPP_
+#define CLIENT_GRAPHICS_FRAME_CONTEXT_HPP_
+
+#include "../gamestate.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+namespace jetpack {
+namespace graphics {
+
+// Built once at the start of Renderer::render() and passed to every stage,
+// so a frame takes the GameState lock a single time
+struct FrameContext {
+  GameSnapshot state;
+
+  // Map size in display pixels
+  float mapTotalWidth = 0.0f;
+  float mapTotalHeight = 0.0f;
+
+  // Display position of each entry of state.players
+  std::vector<sf::Vector2f> playerPositions;
+
+  // Index into state.players of the local player, or -1 when absent
+  int localPlayer = -1;
+
+  // Seconds since the renderer started, drives the animations
+  float time = 0.0f;
+
+  void update(const GameState &gameState, float tileSize);
+
+  // Convert server coordinates (0..1000) to display coordinates
+  sf::Vector2f toDisplay(uint16_t serverX, uint16_t serverY) const {
+    return sf::Vector2f(serverX * serverToDisplayX_,
+                        serverY * serverToDisplayY_);
+  }
+
+private:
+  float serverToDisplayX_ = 0.0f;
+  float serverToDisplayY_ = 0.0f;
+};
+
+} // namespace graphics
+} // namespace jetpack
+
+#endif // CLIENT_GRAPHICS_FRAME_CONTEXT_HPP_
@@ -8,6 +8,8 @@
 
 #include "graphics.hpp"
 #include "../debug/debug.hpp"
+#include "../debug/latency_probe.hpp"
+#include "../debug/trace.hpp"
 #include <iostream>
 #include <memory>
 #include <thread>
@@ -20,6 +22,7 @@ Graphics::Graphics(GameState *gameState, bool debugMode)
       graphicsInitialized_(false) {
 
   renderer_ = std::make_unique<Renderer>(gameState, debugMode);
+  renderer_->setProfiler(&profiler_);
   inputHandler_ = std::make_unique<InputHandler>(gameState, debugMode);
 
   inputHandler_->setOnWindowResizeCallback(
@@ -67,15 +70,32 @@ bool Graphics::initializeResources() {
 void Graphics::run() {
   running_ = true;
   graphicsThread_ = std::thread([this]() {
+    debug::setTraceThreadName("render");
     graphicsInitialized_ = initializeWindow();
 
     if (graphicsInitialized_) {
       initializeResources();
 
+      if (debugMode_) {
+        std::string csvPath =
+            "debug/frames_" + debug::getFileTimestamp() + ".csv";
+        if (profiler_.start(csvPath)) {
+          debug::print("Graphics", "Frame timings written to " + csvPath,
+                       debugMode_);
+        }
+      }
+
       while (running_ && window_ && window_->isOpen()) {
-        processEvents();
+        debug::TraceSpan frameSpan("frame");
+        profiler_.beginFrame();
+        {
+          debug::ScopedTimer timer(&profiler_, debug::FrameStage::Events);
+          processEvents();
+        }
         renderer_->render(window_.get());
+        profiler_.endFrame();
       }
+      profiler_.stop();
 
       if (!window_->isOpen()) {
         debug::print("Graphics",
@@ -113,6 +133,19 @@ void Graphics::setOnCountdownEndCallback(std::function<void()> callback) {
   renderer_->setOnCountdownEndCallback(callback);
 }
 
+void Graphics::setOnKeyPressedCallback(
+    std::function<void(sf::Keyboard::Key)> callback) {
+  inputHandler_->setOnKeyPressedCallback(callback);
+}
+
+void Graphics::injectKey(sf::Keyboard::Key key, bool isPressed) {
+  if (debug::isProbing()) {
+    debug::probeEvent("inject", -1, isPressed ? 1 : 0, 0);
+  }
+  std::lock_guard<std::mutex> lock(injectedMutex_);
+  injectedKeys_.emplace_back(key, isPressed);
+}
+
 void Graphics::processEvents() {
   if (!window_)
     return;
@@ -121,13 +154,19 @@ void Graphics::processEvents() {
   while (window_->pollEvent(event)) {
     inputHandler_->processEvent(event, window_.get());
   }
+
+  std::lock_guard<std::mutex> lock(injectedMutex_);
+  for (const auto &injected : injectedKeys_) {
+    inputHandler_->injectKey(injected.first, injected.second);
+  }
+  injectedKeys_.clear();
 }
 
 void Graphics::handleWindowResize(unsigned int width, unsigned int height) {
   if (!window_ || !renderer_)
     return;
 
-  renderer_->handleResize(window_.get(), width, height);
+  renderer_->handleResize(width, height);
 }
 
 } // namespace graphics
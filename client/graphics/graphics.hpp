@@ -9,6 +9,7 @@
 #ifndef CLIENT_GRAPHICS_GRAPHICS_HPP_
 #define CLIENT_GRAPHICS_GRAPHICS_HPP_
 
+#include "../debug/frame_profiler.hpp"
 #include "../gamestate.hpp"
 #include "input_handler.hpp"
 #include "renderer.hpp"
@@ -16,7 +17,10 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 namespace jetpack {
 namespace graphics {
@@ -36,6 +40,13 @@ public:
   // Function to set callback for when the game end countdown finishes
   void setOnCountdownEndCallback(std::function<void()> callback);
 
+  // Function to set callback for every key press (replay controls)
+  void setOnKeyPressedCallback(std::function<void(sf::Keyboard::Key)> callback);
+
+  // Queue a synthetic key event, applied through the InputHandler at the
+  // start of the next frame; callable from any thread
+  void injectKey(sf::Keyboard::Key key, bool isPressed);
+
 private:
   // Window and game state
   std::unique_ptr<sf::RenderWindow> window_;
@@ -47,10 +58,17 @@ private:
   // Font resource
   sf::Font font_;
 
+  // Per-stage frame timings, recorded in debug mode only
+  debug::FrameProfiler profiler_;
+
   // Component classes
   std::unique_ptr<Renderer> renderer_;
   std::unique_ptr<InputHandler> inputHandler_;
 
+  // Injected key events waiting for the render thread
+  std::mutex injectedMutex_;
+  std::vector<std::pair<sf::Keyboard::Key, bool>> injectedKeys_;
+
   // Graphics methods
   bool initializeWindow();
   bool initializeResources();
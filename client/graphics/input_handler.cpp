@@ -8,13 +8,15 @@
 
 #include "input_handler.hpp"
 #include "../debug/debug.hpp"
+#include "../debug/latency_probe.hpp"
 
 namespace jetpack {
 namespace graphics {
 
 InputHandler::InputHandler(GameState *gameState, bool debugMode)
     : gameState_(gameState), debugMode_(debugMode),
-      onWindowClosedCallback_(nullptr), onWindowResizeCallback_(nullptr) {}
+      onWindowClosedCallback_(nullptr), onWindowResizeCallback_(nullptr),
+      onKeyPressedCallback_(nullptr) {}
 
 void InputHandler::setOnWindowClosedCallback(std::function<void()> callback) {
   onWindowClosedCallback_ = callback;
@@ -25,6 +27,15 @@ void InputHandler::setOnWindowResizeCallback(
   onWindowResizeCallback_ = callback;
 }
 
+void InputHandler::setOnKeyPressedCallback(
+    std::function<void(sf::Keyboard::Key)> callback) {
+  onKeyPressedCallback_ = callback;
+}
+
+void InputHandler::injectKey(sf::Keyboard::Key key, bool isPressed) {
+  handleKeyPress(key, isPressed);
+}
+
 void InputHandler::processEvent(const sf::Event &event,
                                 sf::RenderWindow *window) {
   if (!window)
@@ -47,6 +58,9 @@ void InputHandler::processEvent(const sf::Event &event,
     break;
 
   case sf::Event::KeyPressed:
+    if (onKeyPressedCallback_) {
+      onKeyPressedCallback_(event.key.code);
+    }
     handleKeyPress(event.key.code, true);
     break;
 
@@ -77,6 +91,10 @@ void InputHandler::handleKeyPress(sf::Keyboard::Key key, bool isPressed) {
 
   if (newJetpackState != jetpackCurrentlyActive) {
     gameState_->setJetpackActive(newJetpackState);
+    if (debug::isProbing()) {
+      debug::probeEvent("input", gameState_->getAssignedId(),
+                        newJetpackState ? 1 : 0, 0);
+    }
     if (debugMode_) {
       debug::logToFile("InputHandler",
                        "Jetpack state changed to: " +
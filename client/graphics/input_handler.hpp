@@ -31,11 +31,19 @@ public:
   void setOnWindowResizeCallback(
       std::function<void(unsigned int, unsigned int)> callback);
 
+  // Set callback for key presses, run before the jetpack handling
+  void setOnKeyPressedCallback(std::function<void(sf::Keyboard::Key)> callback);
+
+  // Apply a synthetic key event as if it came from the window (latency
+  // harness); render thread only, like processEvent()
+  void injectKey(sf::Keyboard::Key key, bool isPressed);
+
 private:
   GameState *gameState_;
   bool debugMode_;
   std::function<void()> onWindowClosedCallback_;
   std::function<void(unsigned int, unsigned int)> onWindowResizeCallback_;
+  std::function<void(sf::Keyboard::Key)> onKeyPressedCallback_;
 
   // Helper to handle key presses
   void handleKeyPress(sf::Keyboard::Key key, bool isPressed);
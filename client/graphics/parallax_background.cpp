@@ -0,0 +1,57 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Parallax background implementation
+*/
+
+#include "parallax_background.hpp"
+#include "../debug/frame_profiler.hpp"
+#include <cmath>
+
+namespace jetpack {
+namespace graphics {
+
+bool ParallaxBackground::addLayer(const std::string &path,
+                                  float scrollFactor) {
+  auto layer = std::make_unique<Layer>();
+
+  if (!layer->texture.loadFromFile(path))
+    return false;
+  layer->texture.setRepeated(true);
+  layer->texture.setSmooth(true);
+  layer->scrollFactor = scrollFactor;
+  layer->quad.setPrimitiveType(sf::Quads);
+  layer->quad.resize(4);
+  layers_.push_back(std::move(layer));
+  return true;
+}
+
+void ParallaxBackground::draw(sf::RenderTarget &target,
+                              const sf::Vector2f &size, float cameraOffsetX) {
+  for (auto &layer : layers_) {
+    sf::Vector2u textureSize = layer->texture.getSize();
+    if (textureSize.x == 0 || textureSize.y == 0)
+      continue;
+
+    // The texture is scaled to the area height and repeats horizontally;
+    // wrapping the offset keeps texture coordinates small
+    float scale = size.y / textureSize.y;
+    float u0 = std::fmod(cameraOffsetX * layer->scrollFactor / scale,
+                         static_cast<float>(textureSize.x));
+    float u1 = u0 + size.x / scale;
+    float v1 = static_cast<float>(textureSize.y);
+
+    sf::VertexArray &quad = layer->quad;
+    quad[0] = sf::Vertex(sf::Vector2f(0, 0), sf::Vector2f(u0, 0));
+    quad[1] = sf::Vertex(sf::Vector2f(size.x, 0), sf::Vector2f(u1, 0));
+    quad[2] = sf::Vertex(sf::Vector2f(size.x, size.y), sf::Vector2f(u1, v1));
+    quad[3] = sf::Vertex(sf::Vector2f(0, size.y), sf::Vector2f(u0, v1));
+    target.draw(quad, sf::RenderStates(&layer->texture));
+    debug::countDrawCalls();
+  }
+}
+
+} // namespace graphics
+} // namespace jetpack
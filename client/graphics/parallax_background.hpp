@@ -0,0 +1,46 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Scrolling parallax background, one quad per layer
+*/
+
+#ifndef CLIENT_GRAPHICS_PARALLAX_BACKGROUND_HPP_
+#define CLIENT_GRAPHICS_PARALLAX_BACKGROUND_HPP_
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace graphics {
+
+class ParallaxBackground {
+public:
+  ParallaxBackground() = default;
+  ~ParallaxBackground() = default;
+
+  // Add a layer drawn after (in front of) the previous ones. scrollFactor
+  // is the fraction of the camera movement the layer follows.
+  bool addLayer(const std::string &path, float scrollFactor);
+
+  // Fill a screen-space area of the given size, one draw call per layer
+  void draw(sf::RenderTarget &target, const sf::Vector2f &size,
+            float cameraOffsetX);
+
+private:
+  struct Layer {
+    sf::Texture texture;
+    float scrollFactor;
+    sf::VertexArray quad;
+  };
+
+  std::vector<std::unique_ptr<Layer>> layers_;
+};
+
+} // namespace graphics
+} // namespace jetpack
+
+#endif // CLIENT_GRAPHICS_PARALLAX_BACKGROUND_HPP_
@@ -0,0 +1,146 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Profiler overlay implementation
+*/
+
+#include "profiler_overlay.hpp"
+#include <algorithm>
+#include <iomanip>
+
+namespace jetpack {
+namespace graphics {
+
+namespace {
+
+constexpr float PIXELS_PER_MS = 3.0f;
+constexpr float BAR_WIDTH = 1.0f;
+constexpr float BUDGET_MS = 1000.0f / 60.0f;
+constexpr float GRAPH_HEIGHT = 2.0f * BUDGET_MS * PIXELS_PER_MS;
+
+// Re-layout the table a few times per second rather than every frame
+constexpr unsigned int TABLE_REFRESH_FRAMES = 15;
+
+using debug::FrameProfiler;
+using debug::FrameStage;
+
+// Stacked stages, bottom to top; Total is drawn as a table row only
+const FrameStage GRAPH_STAGES[] = {FrameStage::Events,  FrameStage::Camera,
+                                   FrameStage::Map,     FrameStage::Players,
+                                   FrameStage::Upscale, FrameStage::Ui,
+                                   FrameStage::Display};
+
+const sf::Color STAGE_COLORS[] = {
+    sf::Color(120, 120, 255), sf::Color(0, 200, 200), sf::Color(80, 200, 80),
+    sf::Color(230, 230, 60),  sf::Color(255, 150, 0), sf::Color(230, 80, 230),
+    sf::Color(220, 60, 60)};
+
+} // namespace
+
+ProfilerOverlay::ProfilerOverlay() : bars_(sf::Quads) {}
+
+void ProfilerOverlay::setup(const sf::Font &font) {
+  table_.setup(font, 11, sf::Color::White);
+  tableStream_ << std::fixed << std::setprecision(2);
+}
+
+void ProfilerOverlay::draw(sf::RenderTarget &target,
+                           const FrameProfiler &profiler,
+                           const sf::Vector2f &origin) {
+  const float graphWidth = FrameProfiler::HISTORY_FRAMES * BAR_WIDTH;
+
+  bars_.clear();
+  appendRect(sf::FloatRect(origin.x, origin.y - GRAPH_HEIGHT, graphWidth,
+                           GRAPH_HEIGHT),
+             sf::Color(0, 0, 0, 150));
+
+  // Newest frame on the right
+  for (size_t age = 0; age < profiler.frameCount(); ++age) {
+    float x = origin.x + graphWidth - (age + 1) * BAR_WIDTH;
+    float bottom = origin.y;
+
+    for (size_t i = 0; i < sizeof(GRAPH_STAGES) / sizeof(GRAPH_STAGES[0]);
+         ++i) {
+      float height =
+          std::min(profiler.sample(GRAPH_STAGES[i], age) * PIXELS_PER_MS,
+                   bottom - (origin.y - GRAPH_HEIGHT));
+      if (height <= 0.0f)
+        continue;
+      bottom -= height;
+      appendRect(sf::FloatRect(x, bottom, BAR_WIDTH, height), STAGE_COLORS[i]);
+    }
+  }
+
+  // 60 FPS budget line
+  appendRect(sf::FloatRect(origin.x, origin.y - BUDGET_MS * PIXELS_PER_MS,
+                           graphWidth, 1.0f),
+             sf::Color::White);
+  target.draw(bars_);
+  debug::countDrawCalls();
+
+  if (framesUntilRefresh_ == 0) {
+    refreshTable(profiler);
+    framesUntilRefresh_ = TABLE_REFRESH_FRAMES;
+  }
+  framesUntilRefresh_--;
+  table_.setPosition(origin.x + graphWidth + 10.0f, origin.y - GRAPH_HEIGHT);
+  table_.draw(target);
+}
+
+void ProfilerOverlay::appendRect(const sf::FloatRect &rect,
+                                 const sf::Color &color) {
+  const float right = rect.left + rect.width;
+  const float bottom = rect.top + rect.height;
+
+  bars_.append(sf::Vertex(sf::Vector2f(rect.left, rect.top), color));
+  bars_.append(sf::Vertex(sf::Vector2f(right, rect.top), color));
+  bars_.append(sf::Vertex(sf::Vector2f(right, bottom), color));
+  bars_.append(sf::Vertex(sf::Vector2f(rect.left, bottom), color));
+}
+
+void ProfilerOverlay::refreshTable(const FrameProfiler &profiler) {
+  tableStream_.str(std::string());
+  tableStream_ << "stage      p50    p95    p99 (ms)\n";
+  for (size_t i = 0; i < FrameProfiler::STAGE_COUNT; ++i) {
+    FrameStage stage = static_cast<FrameStage>(i);
+    tableStream_ << std::left << std::setw(8)
+                 << FrameProfiler::stageName(stage) << std::right
+                 << std::setw(7) << profiler.percentile(stage, 50.0f)
+                 << std::setw(7) << profiler.percentile(stage, 95.0f)
+                 << std::setw(7) << profiler.percentile(stage, 99.0f) << "\n";
+  }
+  if (debug::allocTrackingEnabled())
+    appendAllocRows(profiler);
+  table_.setString(tableStream_.str());
+}
+
+// Frames: mean and worst over the window; packets: since the last refresh
+void ProfilerOverlay::appendAllocRows(const FrameProfiler &profiler) {
+  uint64_t allocations = 0;
+  uint64_t bytes = 0;
+  uint64_t worst = 0;
+  size_t frames = std::max<size_t>(profiler.frameCount(), 1);
+  debug::PacketAllocStats packets = debug::packetAllocStats();
+  uint64_t received =
+      std::max<uint64_t>(packets.packets - lastPackets_.packets, 1);
+  debug::AllocCounts packetAllocs = packets.counts - lastPackets_.counts;
+
+  for (size_t age = 0; age < profiler.frameCount(); ++age) {
+    const debug::AllocCounts &frame = profiler.frameAllocs(age);
+    allocations += frame.allocations;
+    bytes += frame.bytes;
+    worst = std::max(worst, frame.allocations);
+  }
+  lastPackets_ = packets;
+  tableStream_ << "allocs/frame  "
+               << static_cast<double>(allocations) / frames << " (max "
+               << worst << "), " << bytes / frames << " B\n"
+               << "allocs/packet "
+               << static_cast<double>(packetAllocs.allocations) / received
+               << ", " << packetAllocs.bytes / received << " B\n";
+}
+
+} // namespace graphics
+} // namespace jetpack
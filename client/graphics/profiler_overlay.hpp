@@ -0,0 +1,47 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Frame-time graph and percentile table for the debug overlay
+*/
+
+#ifndef CLIENT_GRAPHICS_PROFILER_OVERLAY_HPP_
+#define CLIENT_GRAPHICS_PROFILER_OVERLAY_HPP_
+
+#include "../debug/frame_profiler.hpp"
+#include "text_cache.hpp"
+#include <SFML/Graphics.hpp>
+#include <sstream>
+
+namespace jetpack {
+namespace graphics {
+
+class ProfilerOverlay {
+public:
+  ProfilerOverlay();
+  ~ProfilerOverlay() = default;
+
+  void setup(const sf::Font &font);
+
+  // Draw a stacked per-stage bar per frame of the window with its
+  // bottom-left corner at origin, and the percentile table to its right
+  void draw(sf::RenderTarget &target, const debug::FrameProfiler &profiler,
+            const sf::Vector2f &origin);
+
+private:
+  sf::VertexArray bars_;
+  CachedText table_;
+  std::ostringstream tableStream_;
+  unsigned int framesUntilRefresh_ = 0;
+  debug::PacketAllocStats lastPackets_; // At the previous table refresh
+
+  void appendRect(const sf::FloatRect &rect, const sf::Color &color);
+  void refreshTable(const debug::FrameProfiler &profiler);
+  void appendAllocRows(const debug::FrameProfiler &profiler);
+};
+
+} // namespace graphics
+} // namespace jetpack
+
+#endif // CLIENT_GRAPHICS_PROFILER_OVERLAY_HPP_
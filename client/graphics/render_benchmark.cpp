@@ -0,0 +1,200 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Offscreen renderer benchmark driven by a recorded match
+*/
+
+#include "render_benchmark.hpp"
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+
+namespace jetpack {
+namespace graphics {
+
+namespace {
+
+// Nearest-rank percentile, percent in [0, 100]
+float percentile(std::vector<float> values, float percent) {
+  if (values.empty())
+    return 0.0f;
+  size_t rank = static_cast<size_t>(percent / 100.0f * (values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + rank, values.end());
+  return values[rank];
+}
+
+std::string escapeJson(const std::string &text) {
+  std::string escaped;
+
+  for (char c : text) {
+    if (c == '"' || c == '\\')
+      escaped += '\\';
+    if (static_cast<unsigned char>(c) >= 0x20)
+      escaped += c;
+  }
+  return escaped;
+}
+
+} // namespace
+
+RenderBenchmark::RenderBenchmark(replay::ReplayReader *reader,
+                                 const RenderBenchmarkOptions &options)
+    : reader_(reader), options_(options) {}
+
+bool RenderBenchmark::run() {
+  GameState gameState;
+  replay::ReplayPlayer player(reader_, &gameState);
+  Renderer renderer(&gameState, false);
+  debug::FrameProfiler profiler;
+  sf::RenderTexture target;
+  sf::Font font;
+
+  if (!target.create(options_.width, options_.height))
+    return fail("Cannot create a render texture (no OpenGL context)");
+  if (!font.loadFromFile("assets/jetpack_font.ttf"))
+    return fail("Cannot load assets/jetpack_font.ttf");
+  target.setActive(true);
+  const GLubyte *glName = glGetString(GL_RENDERER);
+  glRenderer_ = glName ? reinterpret_cast<const char *>(glName) : "unknown";
+
+  profiler.start("");
+  renderer.setProfiler(&profiler);
+  if (!renderer.initialize(font))
+    return fail("Renderer initialization failed");
+  renderer.handleResize(options_.width, options_.height);
+  renderer.setFixedRenderScale(1.0f);
+
+  player.load();
+  auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < options_.passes; pass++) {
+    if (pass > 0) {
+      player.rewind();
+      player.step();
+    }
+    do {
+      renderOne(renderer, target, profiler);
+    } while (player.step());
+  }
+  seconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                           start)
+                 .count();
+  return frames_ > 0 || fail("The replay holds no frame");
+}
+
+bool RenderBenchmark::fail(const std::string &message) {
+  error_ = message;
+  return false;
+}
+
+void RenderBenchmark::renderOne(Renderer &renderer, sf::RenderTexture &target,
+                                debug::FrameProfiler &profiler) {
+  profiler.beginFrame();
+  renderer.renderFrame(target);
+  {
+    debug::ScopedTimer timer(&profiler, debug::FrameStage::Display);
+    target.display();
+    glFinish();
+  }
+  profiler.endFrame();
+
+  for (size_t i = 0; i < STAGE_COUNT; i++) {
+    debug::FrameStage stage = static_cast<debug::FrameStage>(i);
+    samples_[i].push_back(profiler.sample(stage, 0));
+    drawCalls_[i] += profiler.drawCalls(stage, 0);
+  }
+  allocs_.allocations += profiler.frameAllocs(0).allocations;
+  allocs_.bytes += profiler.frameAllocs(0).bytes;
+  frames_++;
+}
+
+RenderBenchmark::StageSummary RenderBenchmark::summarize(size_t stage) const {
+  const std::vector<float> &samples = samples_[stage];
+  StageSummary summary;
+  double sum = 0.0;
+
+  if (samples.empty())
+    return summary;
+  for (float sample : samples)
+    sum += sample;
+  summary.meanMs = sum / samples.size();
+  summary.p50Ms = percentile(samples, 50.0f);
+  summary.p90Ms = percentile(samples, 90.0f);
+  summary.p99Ms = percentile(samples, 99.0f);
+  summary.maxMs = *std::max_element(samples.begin(), samples.end());
+  summary.drawCallsPerFrame =
+      static_cast<double>(drawCalls_[stage]) / samples.size();
+  return summary;
+}
+
+void RenderBenchmark::printReport(std::ostream &out) const {
+  out << "Rendered " << frames_ << " frames at " << options_.width << "x"
+      << options_.height << " in " << std::fixed << std::setprecision(2)
+      << seconds_ << " s: " << (seconds_ > 0 ? frames_ / seconds_ : 0.0)
+      << " FPS (" << glRenderer_ << ")" << std::endl;
+  out << std::left << std::setw(10) << "stage" << std::right
+      << std::setw(9) << "mean ms" << std::setw(9) << "p50 ms"
+      << std::setw(9) << "p90 ms" << std::setw(9) << "p99 ms"
+      << std::setw(9) << "max ms" << std::setw(13) << "draws/frame"
+      << std::endl;
+  out << std::setprecision(3);
+  for (size_t i = 0; i < STAGE_COUNT; i++) {
+    StageSummary summary = summarize(i);
+    out << std::left << std::setw(10)
+        << debug::FrameProfiler::stageName(static_cast<debug::FrameStage>(i))
+        << std::right << std::setw(9) << summary.meanMs << std::setw(9)
+        << summary.p50Ms << std::setw(9) << summary.p90Ms << std::setw(9)
+        << summary.p99Ms << std::setw(9) << summary.maxMs << std::setw(13)
+        << std::setprecision(1) << summary.drawCallsPerFrame
+        << std::setprecision(3) << std::endl;
+  }
+  if (debug::allocTrackingEnabled() && frames_ > 0) {
+    out << std::setprecision(1) << "Allocations per frame: "
+        << static_cast<double>(allocs_.allocations) / frames_ << " ("
+        << static_cast<double>(allocs_.bytes) / frames_ << " bytes)"
+        << std::endl;
+  }
+}
+
+bool RenderBenchmark::writeJson(const std::string &path) const {
+  std::ofstream out(path);
+
+  if (!out)
+    return false;
+  out << "{\n  \"suite\": \"jetpack_render_bench\",\n"
+      << "  \"replay\": \"" << escapeJson(options_.replayPath) << "\",\n"
+      << "  \"gl_renderer\": \"" << escapeJson(glRenderer_) << "\",\n"
+      << "  \"timestamp\": " << std::time(nullptr) << ",\n"
+      << "  \"width\": " << options_.width << ",\n"
+      << "  \"height\": " << options_.height << ",\n"
+      << "  \"frames\": " << frames_ << ",\n";
+  out << std::fixed << std::setprecision(3) << "  \"seconds\": " << seconds_
+      << ",\n  \"fps\": " << (seconds_ > 0 ? frames_ / seconds_ : 0.0);
+  if (debug::allocTrackingEnabled() && frames_ > 0) {
+    out << ",\n  \"allocs_per_frame\": "
+        << static_cast<double>(allocs_.allocations) / frames_
+        << ",\n  \"alloc_bytes_per_frame\": "
+        << static_cast<double>(allocs_.bytes) / frames_;
+  }
+  out << ",\n  \"stages\": [";
+  for (size_t i = 0; i < STAGE_COUNT; i++) {
+    StageSummary summary = summarize(i);
+    out << (i ? ",\n" : "\n") << "    {\"name\": \""
+        << debug::FrameProfiler::stageName(static_cast<debug::FrameStage>(i))
+        << "\", \"mean_ms\": " << summary.meanMs
+        << ", \"p50_ms\": " << summary.p50Ms
+        << ", \"p90_ms\": " << summary.p90Ms
+        << ", \"p99_ms\": " << summary.p99Ms
+        << ", \"max_ms\": " << summary.maxMs
+        << ", \"draw_calls_per_frame\": " << summary.drawCallsPerFrame << "}";
+  }
+  out << "\n  ]\n}\n";
+  return static_cast<bool>(out);
+}
+
+} // namespace graphics
+} // namespace jetpack
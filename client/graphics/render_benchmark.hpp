@@ -0,0 +1,77 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Offscreen renderer benchmark driven by a recorded match
+*/
+
+#ifndef CLIENT_GRAPHICS_RENDER_BENCHMARK_HPP_
+#define CLIENT_GRAPHICS_RENDER_BENCHMARK_HPP_
+
+#include "../debug/frame_profiler.hpp"
+#include "../replay/replay_player.hpp"
+#include "renderer.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace graphics {
+
+struct RenderBenchmarkOptions {
+  std::string replayPath;
+  unsigned int width = 1280;
+  unsigned int height = 720;
+  int passes = 1;         // Times the whole replay is rendered
+  std::string outputPath; // JSON report, none when empty
+};
+
+// Renders every frame of a replay into a render texture, back to back,
+// with the renderer's own stage timers; each frame waits for the GL queue
+// to drain so the timings include the rasterisation
+class RenderBenchmark {
+public:
+  RenderBenchmark(replay::ReplayReader *reader,
+                  const RenderBenchmarkOptions &options);
+
+  bool run();
+  const std::string &error() const { return error_; }
+
+  void printReport(std::ostream &out) const;
+  bool writeJson(const std::string &path) const;
+
+private:
+  static constexpr size_t STAGE_COUNT = debug::FrameProfiler::STAGE_COUNT;
+
+  struct StageSummary {
+    double meanMs = 0.0;
+    float p50Ms = 0.0f;
+    float p90Ms = 0.0f;
+    float p99Ms = 0.0f;
+    float maxMs = 0.0f;
+    double drawCallsPerFrame = 0.0;
+  };
+
+  replay::ReplayReader *reader_;
+  RenderBenchmarkOptions options_;
+  std::string error_;
+  std::string glRenderer_;
+  std::vector<float> samples_[STAGE_COUNT];
+  uint64_t drawCalls_[STAGE_COUNT] = {};
+  debug::AllocCounts allocs_; // Whole frames, with JETPACK_ALLOC_TRACKING
+  size_t frames_ = 0;
+  double seconds_ = 0.0;
+
+  bool fail(const std::string &message);
+  void renderOne(Renderer &renderer, sf::RenderTexture &target,
+                 debug::FrameProfiler &profiler);
+  StageSummary summarize(size_t stage) const;
+};
+
+} // namespace graphics
+} // namespace jetpack
+
+#endif // CLIENT_GRAPHICS_RENDER_BENCHMARK_HPP_
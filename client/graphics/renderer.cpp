@@ -7,6 +7,8 @@
 */
 
 #include "renderer.hpp"
+#include "../debug/latency_probe.hpp"
+#include "../debug/log.hpp"
 #include <chrono>
 #include <sstream>
 
@@ -16,7 +18,8 @@ namespace graphics {
 Renderer::Renderer(GameState *gameState, bool debugMode)
     : gameState_(gameState), debugMode_(debugMode), font_(nullptr),
       gameEndOverlayActive_(false), shutdownCountdownSeconds_(5),
-      onCountdownEndCallback_(nullptr), cameraOffsetX_(0.0f) {
+      onCountdownEndCallback_(nullptr), cameraOffsetX_(0.0f),
+      resolution_(1.0f / 60.0f), tileMap_(TILE_SIZE) {
 
   gameView_.setSize(virtualWidth_, virtualHeight_);
   gameView_.setCenter(virtualWidth_ / 2.0f, virtualHeight_ / 2.0f);
@@ -25,267 +28,300 @@ Renderer::Renderer(GameState *gameState, bool debugMode)
   uiView_.setCenter(virtualWidth_ / 2.0f, virtualHeight_ / 2.0f);
 }
 
+void Renderer::setOnCountdownEndCallback(std::function<void()> callback) {
+  onCountdownEndCallback_ = std::move(callback);
+}
+
+void Renderer::setProfiler(debug::FrameProfiler *profiler) {
+  profiler_ = profiler;
+}
+
 bool Renderer::initialize(sf::Font &font) {
   font_ = &font;
 
-  playerShape_.setRadius(PLAYER_RADIUS);
-  playerShape_.setFillColor(sf::Color::Green);
-  playerShape_.setOrigin(PLAYER_RADIUS, PLAYER_RADIUS);
+  statusText_.setup(font, 16, sf::Color::White);
+  statusText_.setPosition(10, 10);
+  debugText_.setup(font, 12, sf::Color::Red);
+  debugText_.setPosition(virtualWidth_ - 250, 10);
+  connectingText_.setup(font, 24, sf::Color::White);
+  gameOverText_.setup(font, 48, sf::Color::White);
+  scoresTitleText_.setup(font, 24, sf::Color::White);
+  scoresTitleText_.setString("PLAYER SCORES:");
+  countdownText_.setup(font, 24, sf::Color::White);
 
-  wallShape_.setSize(sf::Vector2f(TILE_SIZE, TILE_SIZE));
-  wallShape_.setFillColor(sf::Color(100, 100, 100));
+  sf::Text controlsText;
+  controlsText.setFont(font);
+  controlsText.setString("Controls: Space = Jetpack");
+  controlsText.setCharacterSize(14);
+  controlsText.setFillColor(sf::Color(200, 200, 200));
+  controlsText.setPosition(10, virtualHeight_ - 25);
+  hudLabels_.addLabel(controlsText);
+  hudLabels_.bake(virtualWidth_, virtualHeight_);
+  profilerOverlay_.setup(font);
 
-  coinShape_.setRadius(COIN_RADIUS);
-  coinShape_.setFillColor(sf::Color::Yellow);
-  coinShape_.setOrigin(COIN_RADIUS, COIN_RADIUS);
+  // The backdrop is optional, the flat clear color shows without it
+  if (!background_.addLayer("assets/background.png", 0.5f)) {
+    JETPACK_LOG_WARN("Renderer", "Failed to load assets/background.png");
+  }
 
-  electricShape_.setSize(sf::Vector2f(TILE_SIZE, TILE_SIZE));
-  electricShape_.setFillColor(sf::Color(230, 30, 230));
+  return atlas_.load() && tileMap_.initialize();
+}
 
-  return true;
+void Renderer::setFixedRenderScale(float scale) {
+  resolution_.setFixedScale(scale);
 }
 
 void Renderer::render(sf::RenderWindow *window) {
   if (!window || !window->isOpen() || !font_)
     return;
 
-  window->clear(sf::Color(50, 50, 50));
+  renderFrame(*window);
 
-  if (gameState_->isConnected()) {
-    updateCamera();
+  {
+    debug::ScopedTimer timer(profiler_, debug::FrameStage::Display);
+    window->display();
+  }
+
+  // First presented frame of every tick, the end of input-to-photon
+  if (debug::isProbing() && frame_.state.currentTick != probedTick_) {
+    probedTick_ = frame_.state.currentTick;
+    debug::probeEvent("frame", frame_.state.assignedId, 0, probedTick_);
+  }
+
+  if (countdownExpired_) {
+    if (onCountdownEndCallback_) {
+      onCountdownEndCallback_();
+    }
+    window->close();
+  }
+}
+
+void Renderer::renderFrame(sf::RenderTarget &target) {
+  if (!font_)
+    return;
 
-    window->setView(gameView_);
-    renderMap(window);
-    renderPlayers(window);
+  resolution_.update(frameClock_.restart().asSeconds());
 
-    window->setView(uiView_);
-    renderUI(window, *font_);
+  target.clear(CLEAR_COLOR);
+  frame_.update(*gameState_, TILE_SIZE);
+  frame_.time = animationClock_.getElapsedTime().asSeconds();
 
-    if (gameState_->hasGameEnded()) {
+  {
+    debug::ScopedTimer timer(profiler_, debug::FrameStage::Camera);
+    updateCamera(frame_);
+  }
+  renderWorld(target, frame_);
+
+  debug::ScopedTimer timer(profiler_, debug::FrameStage::Ui);
+  renderHud(target, frame_);
+}
+
+void Renderer::renderHud(sf::RenderTarget &target, const FrameContext &frame) {
+  if (frame.state.connected) {
+    // Labels follow the world but stay at native resolution
+    target.setView(gameView_);
+    renderScoreLabels(target, frame);
+
+    target.setView(uiView_);
+    renderUI(target, frame);
+
+    if (frame.state.gameEnded) {
       if (!gameEndOverlayActive_) {
         gameEndOverlayActive_ = true;
         gameEndTime_ = std::chrono::steady_clock::now();
       }
 
-      window->setView(uiView_);
-      renderGameEndScreen(window, *font_);
+      target.setView(uiView_);
+      renderGameEndScreen(target, frame);
 
       auto currentTime = std::chrono::steady_clock::now();
       auto elapsedSeconds = std::chrono::duration_cast<std::chrono::seconds>(
                                 currentTime - gameEndTime_)
                                 .count();
-
-      if (elapsedSeconds >= shutdownCountdownSeconds_) {
-        if (onCountdownEndCallback_) {
-          onCountdownEndCallback_();
-        }
-        window->close();
-      }
+      countdownExpired_ = elapsedSeconds >= shutdownCountdownSeconds_;
+    } else {
+      gameEndOverlayActive_ = false; // A replay seeked back before the end
+      countdownExpired_ = false;
     }
   } else {
-    window->setView(uiView_);
-    renderConnectingMessage(window, *font_);
+    target.setView(uiView_);
+    renderConnectingMessage(target);
   }
 
   if (debugMode_) {
-    window->setView(uiView_);
-    renderDebugInfo(window, *font_);
+    target.setView(uiView_);
+    renderDebugInfo(target, frame);
   }
-
-  window->display();
 }
 
-void Renderer::renderMap(sf::RenderWindow *window) {
-  std::pair<uint16_t, uint16_t> mapDimensions = gameState_->getMapDimensions();
-  uint16_t mapWidth = mapDimensions.first;
-  uint16_t mapHeight = mapDimensions.second;
-
-  if (mapWidth == 0 || mapHeight == 0)
-    return;
-
-  std::vector<uint8_t> mapData = gameState_->getMapData();
-  if (mapData.empty())
-    return;
-
-  auto players = gameState_->getPlayerStates();
-  uint8_t localPlayerId = gameState_->getAssignedId();
+void Renderer::renderWorld(sf::RenderTarget &output,
+                           const FrameContext &frame) {
+  sf::IntRect viewport = output.getViewport(gameView_);
+  sf::RenderTarget *offscreen = resolution_.begin(viewport);
+  sf::RenderTarget &target = offscreen ? *offscreen : output;
+  sf::View backdropView = uiView_;
+  sf::View worldView = gameView_;
+
+  // The offscreen image only covers the letterboxed viewport
+  if (offscreen) {
+    offscreen->clear(CLEAR_COLOR);
+    backdropView.setViewport(sf::FloatRect(0, 0, 1, 1));
+    worldView.setViewport(sf::FloatRect(0, 0, 1, 1));
+  }
 
-  for (const auto &player : players) {
-    if (player.collectedCoin) {
-      sf::Vector2f displayPos =
-          convertServerToDisplayCoords(player.posX, player.posY);
-      uint16_t tileX = static_cast<uint16_t>(displayPos.x / TILE_SIZE);
-      uint16_t tileY = static_cast<uint16_t>(displayPos.y / TILE_SIZE);
+  {
+    debug::ScopedTimer timer(profiler_, debug::FrameStage::Map);
+    target.setView(backdropView);
+    background_.draw(target, backdropView.getSize(), cameraOffsetX_);
 
-      if (player.id == localPlayerId) {
-        gameState_->addCollectedCoinByLocalPlayer(tileX, tileY);
-      } else {
-        gameState_->addCollectedCoinByOtherPlayer(tileX, tileY);
-      }
+    if (frame.state.connected) {
+      target.setView(worldView);
+      spriteBatch_.clear();
+      renderMap(target, frame);
     }
   }
 
-  for (uint16_t y = 0; y < mapHeight; ++y) {
-    for (uint16_t x = 0; x < mapWidth; ++x) {
-      size_t index = y * mapWidth + x;
-      if (index >= mapData.size())
-        continue;
+  if (frame.state.connected) {
+    debug::ScopedTimer timer(profiler_, debug::FrameStage::Players);
+    queuePlayers(frame);
+    spriteBatch_.draw(target, atlas_.getTexture());
+  }
 
-      uint8_t tile = mapData[index];
+  if (offscreen) {
+    debug::ScopedTimer timer(profiler_, debug::FrameStage::Upscale);
+    resolution_.present(output, output.getSize());
+  }
+}
 
-      switch (tile) {
-      case protocol::WALL: {
-        wallShape_.setPosition(x * TILE_SIZE, y * TILE_SIZE);
-        window->draw(wallShape_);
-        break;
-      }
-      case protocol::COIN: {
-        bool collectedByLocalPlayer =
-            gameState_->isCoinCollectedByLocalPlayer(x, y);
-        bool collectedByOtherPlayer =
-            gameState_->isCoinCollectedByOtherPlayer(x, y);
-
-        if (collectedByLocalPlayer && collectedByOtherPlayer) {
-          break;
-        }
-        if (collectedByLocalPlayer) {
-          coinShape_.setFillColor(sf::Color(150, 150, 150)); // Gris
-        } else {
-          coinShape_.setFillColor(sf::Color::Yellow);
-        }
-        coinShape_.setPosition(x * TILE_SIZE + TILE_SIZE / 2,
-                               y * TILE_SIZE + TILE_SIZE / 2);
-        window->draw(coinShape_);
-        break;
-      }
-      case protocol::ELECTRIC: {
-        electricShape_.setPosition(x * TILE_SIZE, y * TILE_SIZE);
-        window->draw(electricShape_);
-        break;
-      }
-      default:
-        break;
-      }
-    }
+void Renderer::renderMap(sf::RenderTarget &target, const FrameContext &frame) {
+  if (frame.state.mapWidth == 0 || frame.state.mapHeight == 0)
+    return;
+
+  if (frame.state.mapRevision != mapRevision_) {
+    std::vector<uint8_t> mapData = gameState_->getMapData();
+    if (mapData.empty())
+      return;
+    tileMap_.setMap(frame.state.mapWidth, frame.state.mapHeight, mapData);
+    mapRevision_ = frame.state.mapRevision;
   }
+
+  tileMap_.syncCoins(*gameState_);
+  tileMap_.draw(target, gameView_);
+  tileMap_.appendAnimated(
+      spriteBatch_, gameView_,
+      atlas_.getAnimation(AnimationId::Coin).frameAt(frame.time),
+      atlas_.getAnimation(AnimationId::Zapper).frameAt(frame.time));
 }
 
-void Renderer::renderPlayers(sf::RenderWindow *window) {
-  auto players = gameState_->getPlayerStates();
-  uint8_t currentPlayerId = gameState_->getAssignedId();
+void Renderer::queuePlayers(const FrameContext &frame) {
+  const sf::IntRect &runFrame =
+      atlas_.getAnimation(AnimationId::PlayerRun).frameAt(frame.time);
+  const sf::IntRect &flyFrame =
+      atlas_.getAnimation(AnimationId::PlayerFly).frameAt(frame.time);
+  // Other players keep the red tint the old circles had
+  const sf::Color otherTint(255, 120, 120);
 
-  for (const auto &player : players) {
+  for (size_t i = 0; i < frame.state.players.size(); i++) {
+    const auto &player = frame.state.players[i];
     if (!player.alive)
       continue;
 
-    sf::Color playerColor =
-        (player.id == currentPlayerId) ? sf::Color::Green : sf::Color::Red;
-
-    playerShape_.setFillColor(playerColor);
+    const sf::Vector2f &displayPos = frame.playerPositions[i];
+    sf::FloatRect rect(displayPos.x - PLAYER_SIZE / 2.0f,
+                       displayPos.y - PLAYER_SIZE / 2.0f, PLAYER_SIZE,
+                       PLAYER_SIZE);
+    bool onGround = player.posY >= 990;
 
-    sf::Vector2f displayPos =
-        convertServerToDisplayCoords(player.posX, player.posY);
+    spriteBatch_.add(rect, onGround ? runFrame : flyFrame,
+                     (player.id == frame.state.assignedId) ? sf::Color::White
+                                                           : otherTint);
+  }
+}
 
-    playerShape_.setPosition(displayPos.x, displayPos.y);
-    window->draw(playerShape_);
+void Renderer::renderScoreLabels(sf::RenderTarget &target,
+                                 const FrameContext &frame) {
+  for (size_t i = 0; i < frame.state.players.size(); i++) {
+    const auto &player = frame.state.players[i];
+    if (!player.alive)
+      continue;
 
-    sf::Text scoreText;
-    scoreText.setFont(*font_);
+    const sf::Vector2f &displayPos = frame.playerPositions[i];
+    CachedText &scoreText = scoreLabel(player.id);
     scoreText.setString(std::to_string(player.score));
-    scoreText.setCharacterSize(12);
-    scoreText.setFillColor(sf::Color::White);
     scoreText.setPosition(displayPos.x - 5, displayPos.y - 25);
-    window->draw(scoreText);
+    scoreText.draw(target);
   }
 }
 
-void Renderer::renderUI(sf::RenderWindow *window, const sf::Font &font) {
-  sf::Text statusText;
-  statusText.setFont(font);
+void Renderer::renderUI(sf::RenderTarget &target, const FrameContext &frame) {
+  std::ostringstream &ss = resetTextStream();
+  sf::Color statusColor = sf::Color::White;
 
-  std::stringstream ss;
-  if (gameState_->isGameRunning()) {
-    ss << "Game running   Tick: " << gameState_->getCurrentTick();
-    statusText.setFillColor(sf::Color::White);
-  } else if (gameState_->hasGameEnded()) {
-    uint8_t winnerId = gameState_->getWinnerId();
+  if (frame.state.gameRunning) {
+    ss << "Game running   Tick: " << frame.state.currentTick;
+  } else if (frame.state.gameEnded) {
+    uint8_t winnerId = frame.state.winnerId;
     if (winnerId == protocol::NO_WINNER) {
       ss << "Game ended: No winner";
-    } else if (winnerId == gameState_->getAssignedId()) {
+    } else if (winnerId == frame.state.assignedId) {
       ss << "Game ended: You win!";
-      statusText.setFillColor(sf::Color::Green);
+      statusColor = sf::Color::Green;
     } else {
       ss << "Game ended: Player " << static_cast<int>(winnerId) << " wins";
-      statusText.setFillColor(sf::Color::Red);
+      statusColor = sf::Color::Red;
     }
   } else {
     ss << "Connected, waiting for game start...";
-    statusText.setFillColor(sf::Color::White);
   }
-  statusText.setString(ss.str());
-  statusText.setCharacterSize(16);
-  statusText.setPosition(10, 10);
-  window->draw(statusText);
+  statusText_.setString(ss.str());
+  statusText_.setFillColor(statusColor);
+  statusText_.draw(target);
 
-  sf::Text controlsText;
-  controlsText.setFont(font);
-  controlsText.setString("Controls: Space = Jetpack");
-  controlsText.setCharacterSize(14);
-  controlsText.setFillColor(sf::Color(200, 200, 200));
-  controlsText.setPosition(10, virtualHeight_ - 25);
-  window->draw(controlsText);
+  hudLabels_.draw(target);
 }
 
-void Renderer::renderDebugInfo(sf::RenderWindow *window, const sf::Font &font) {
-  sf::Text debugText;
-  debugText.setFont(font);
-
-  std::stringstream ss;
+void Renderer::renderDebugInfo(sf::RenderTarget &target,
+                               const FrameContext &frame) {
+  const GameSnapshot &state = frame.state;
+  std::ostringstream &ss = resetTextStream();
   ss << "DEBUG MODE" << std::endl;
-  ss << "Connection: " << (gameState_->isConnected() ? "YES" : "NO")
-     << std::endl;
-  ss << "Player ID: " << static_cast<int>(gameState_->getAssignedId())
-     << std::endl;
-  ss << "Game running: " << (gameState_->isGameRunning() ? "YES" : "NO")
-     << std::endl;
-  ss << "Jetpack: " << (gameState_->isJetpackActive() ? "ACTIVE" : "INACTIVE")
+  ss << "Connection: " << (state.connected ? "YES" : "NO") << std::endl;
+  ss << "Player ID: " << static_cast<int>(state.assignedId) << std::endl;
+  ss << "Game running: " << (state.gameRunning ? "YES" : "NO") << std::endl;
+  ss << "Jetpack: " << (state.jetpackActive ? "ACTIVE" : "INACTIVE")
      << std::endl;
+  ss << "Map: " << state.mapWidth << "x" << state.mapHeight << std::endl;
+  ss << "Render scale: " << static_cast<int>(resolution_.getScale() * 100)
+     << "%" << std::endl;
 
-  auto dimensions = gameState_->getMapDimensions();
-  ss << "Map: " << dimensions.first << "x" << dimensions.second << std::endl;
-
-  auto players = gameState_->getPlayerStates();
-  ss << "Players: " << players.size() << std::endl;
-  for (const auto &player : players) {
+  ss << "Players: " << state.players.size() << std::endl;
+  for (const auto &player : state.players) {
     ss << "  ID " << static_cast<int>(player.id) << " (" << player.posX << ","
        << player.posY << ") "
        << "Score: " << player.score << (player.alive ? "" : " [DEAD]")
        << (player.collectedCoin ? " [COIN]" : "") << std::endl;
   }
 
-  debugText.setString(ss.str());
-  debugText.setCharacterSize(12);
-  debugText.setFillColor(sf::Color::Red);
-  debugText.setPosition(virtualWidth_ - 250, 10);
-  window->draw(debugText);
+  debugText_.setString(ss.str());
+  debugText_.draw(target);
+
+  if (profiler_ && profiler_->isEnabled()) {
+    profilerOverlay_.draw(target, *profiler_,
+                          sf::Vector2f(10.0f, virtualHeight_ - 40.0f));
+  }
 }
 
-void Renderer::renderConnectingMessage(sf::RenderWindow *window,
-                                       const sf::Font &font) {
-  sf::Text text;
-  text.setFont(font);
-  text.setString("Connecting to server...");
-  text.setCharacterSize(24);
-  text.setFillColor(sf::Color::White);
-
-  text.setPosition(virtualWidth_ / 2.0f - text.getLocalBounds().width / 2.0f,
-                   virtualHeight_ / 2.0f - text.getLocalBounds().height / 2.0f);
-  window->draw(text);
+void Renderer::renderConnectingMessage(sf::RenderTarget &target) {
+  if (connectingText_.setString("Connecting to server...")) {
+    sf::FloatRect bounds = connectingText_.getLocalBounds();
+    connectingText_.setPosition(virtualWidth_ / 2.0f - bounds.width / 2.0f,
+                                virtualHeight_ / 2.0f - bounds.height / 2.0f);
+  }
+  connectingText_.draw(target);
 }
 
-void Renderer::handleResize(sf::RenderWindow *window, unsigned int width,
-                            unsigned int height) {
-  if (!window)
+void Renderer::handleResize(unsigned int width, unsigned int height) {
+  if (width == 0 || height == 0)
     return;
 
   float scaleX = static_cast<float>(width) / virtualWidth_;
@@ -305,72 +341,45 @@ void Renderer::handleResize(sf::RenderWindow *window, unsigned int width,
                                     viewWidth / width, viewHeight / height));
 }
 
-void Renderer::updateCamera() {
-  auto players = gameState_->getPlayerStates();
-  std::pair<uint16_t, uint16_t> mapDimensions = gameState_->getMapDimensions();
-  uint16_t mapWidth = mapDimensions.first;
-  uint16_t mapHeight = mapDimensions.second;
-
-  float mapTotalWidth = mapWidth * TILE_SIZE;
-  float mapTotalHeight = mapHeight * TILE_SIZE;
-
-  for (const auto &player : players) {
-    if (player.id == gameState_->getAssignedId() && player.alive) {
-      sf::Vector2f displayPos =
-          convertServerToDisplayCoords(player.posX, player.posY);
-
-      float cameraOffsetX = 0.0f;
-      if (displayPos.x > FIXED_PLAYER_X) {
-        cameraOffsetX = displayPos.x - FIXED_PLAYER_X;
-
-        float maxScrollX = mapTotalWidth - virtualWidth_;
-        if (cameraOffsetX > maxScrollX) {
-          cameraOffsetX = maxScrollX;
-        }
-      }
-
-      float cameraOffsetY = 0.0f;
-
-      cameraOffsetY = displayPos.y - virtualHeight_ / 2.0f;
-
-      if (cameraOffsetY < 0) {
-        cameraOffsetY = 0;
-      } else if (cameraOffsetY > mapTotalHeight - virtualHeight_) {
-        cameraOffsetY = mapTotalHeight - virtualHeight_;
-      }
+void Renderer::updateCamera(const FrameContext &frame) {
+  if (frame.localPlayer < 0 || !frame.state.players[frame.localPlayer].alive)
+    return;
 
-      gameView_.setCenter(virtualWidth_ / 2.0f + cameraOffsetX,
-                          virtualHeight_ / 2.0f + cameraOffsetY);
+  const sf::Vector2f &displayPos = frame.playerPositions[frame.localPlayer];
 
-      cameraOffsetX_ = cameraOffsetX;
+  float cameraOffsetX = 0.0f;
+  if (displayPos.x > FIXED_PLAYER_X) {
+    cameraOffsetX = displayPos.x - FIXED_PLAYER_X;
 
-      break;
+    float maxScrollX = frame.mapTotalWidth - virtualWidth_;
+    if (cameraOffsetX > maxScrollX) {
+      cameraOffsetX = maxScrollX;
     }
   }
-}
 
-sf::Vector2f Renderer::convertServerToDisplayCoords(uint16_t serverX,
-                                                    uint16_t serverY) {
-  std::pair<uint16_t, uint16_t> mapDimensions = gameState_->getMapDimensions();
-  uint16_t mapWidth = mapDimensions.first;
-  uint16_t mapHeight = mapDimensions.second;
+  float cameraOffsetY = 0.0f;
 
-  float mapTotalWidth = mapWidth * TILE_SIZE;
-  float mapTotalHeight = mapHeight * TILE_SIZE;
+  cameraOffsetY = displayPos.y - virtualHeight_ / 2.0f;
 
-  float displayX = (serverX / 1000.0f) * mapTotalWidth;
+  if (cameraOffsetY < 0) {
+    cameraOffsetY = 0;
+  } else if (cameraOffsetY > frame.mapTotalHeight - virtualHeight_) {
+    cameraOffsetY = frame.mapTotalHeight - virtualHeight_;
+  }
 
-  float displayY = (serverY / 1000.0f) * mapTotalHeight;
+  gameView_.setCenter(virtualWidth_ / 2.0f + cameraOffsetX,
+                      virtualHeight_ / 2.0f + cameraOffsetY);
 
-  return sf::Vector2f(displayX, displayY);
+  cameraOffsetX_ = cameraOffsetX;
 }
 
-void Renderer::renderGameEndScreen(sf::RenderWindow *window,
-                                   const sf::Font &font) {
+void Renderer::renderGameEndScreen(sf::RenderTarget &target,
+                                   const FrameContext &frame) {
   sf::RectangleShape overlay;
   overlay.setSize(sf::Vector2f(virtualWidth_, virtualHeight_));
   overlay.setFillColor(sf::Color(0, 0, 0, 230)); // Black with transparency
-  window->draw(overlay);
+  target.draw(overlay);
+  debug::countDrawCalls();
 
   auto currentTime = std::chrono::steady_clock::now();
   auto elapsedSeconds = std::chrono::duration_cast<std::chrono::seconds>(
@@ -378,51 +387,44 @@ void Renderer::renderGameEndScreen(sf::RenderWindow *window,
                             .count();
   int timeLeft = shutdownCountdownSeconds_ - static_cast<int>(elapsedSeconds);
 
-  auto players = gameState_->getPlayerStates();
-  uint8_t winnerId = gameState_->getWinnerId();
-  uint8_t localPlayerId = gameState_->getAssignedId();
-
-  sf::Text gameOverText;
-  gameOverText.setFont(font);
-  gameOverText.setCharacterSize(48);
-  gameOverText.setFillColor(sf::Color::White);
+  const auto &players = frame.state.players;
+  uint8_t winnerId = frame.state.winnerId;
+  uint8_t localPlayerId = frame.state.assignedId;
 
   if (winnerId == protocol::NO_WINNER) {
-    gameOverText.setString("GAME OVER - DRAW");
+    gameOverText_.setString("GAME OVER - DRAW");
+    gameOverText_.setFillColor(sf::Color::White);
   } else if (winnerId == localPlayerId) {
-    gameOverText.setString("YOU WIN!");
-    gameOverText.setFillColor(sf::Color::Green);
+    gameOverText_.setString("YOU WIN!");
+    gameOverText_.setFillColor(sf::Color::Green);
   } else {
-    gameOverText.setString("YOU LOSE");
-    gameOverText.setFillColor(sf::Color::Red);
+    gameOverText_.setString("YOU LOSE");
+    gameOverText_.setFillColor(sf::Color::Red);
   }
 
-  sf::FloatRect gameOverBounds = gameOverText.getLocalBounds();
-  gameOverText.setPosition(virtualWidth_ / 2.0f - gameOverBounds.width / 2.0f,
-                           virtualHeight_ / 2.0f - 100 -
-                               gameOverBounds.height / 2.0f);
-
-  window->draw(gameOverText);
-
-  sf::Text scoresTitle;
-  scoresTitle.setFont(font);
-  scoresTitle.setString("PLAYER SCORES:");
-  scoresTitle.setCharacterSize(24);
-  scoresTitle.setFillColor(sf::Color::White);
-
-  sf::FloatRect scoresTitleBounds = scoresTitle.getLocalBounds();
-  scoresTitle.setPosition(virtualWidth_ / 2.0f - scoresTitleBounds.width / 2.0f,
-                          gameOverText.getPosition().y + gameOverBounds.height +
-                              40);
-
-  window->draw(scoresTitle);
+  sf::FloatRect gameOverBounds = gameOverText_.getLocalBounds();
+  float gameOverY = virtualHeight_ / 2.0f - 100 - gameOverBounds.height / 2.0f;
+  gameOverText_.setPosition(virtualWidth_ / 2.0f - gameOverBounds.width / 2.0f,
+                            gameOverY);
+  gameOverText_.draw(target);
+
+  sf::FloatRect scoresTitleBounds = scoresTitleText_.getLocalBounds();
+  float scoresTitleY = gameOverY + gameOverBounds.height + 40;
+  scoresTitleText_.setPosition(
+      virtualWidth_ / 2.0f - scoresTitleBounds.width / 2.0f, scoresTitleY);
+  scoresTitleText_.draw(target);
+
+  for (size_t i = finalScoreLines_.size(); i < players.size(); i++) {
+    finalScoreLines_.emplace_back();
+    finalScoreLines_.back().setup(*font_, 20, sf::Color::White);
+  }
 
-  float yOffset = scoresTitle.getPosition().y + scoresTitleBounds.height + 20;
-  for (const auto &player : players) {
-    sf::Text playerText;
-    playerText.setFont(font);
+  float yOffset = scoresTitleY + scoresTitleBounds.height + 20;
+  for (size_t i = 0; i < players.size(); i++) {
+    const auto &player = players[i];
+    CachedText &playerText = finalScoreLines_[i];
 
-    std::stringstream ss;
+    std::ostringstream &ss = resetTextStream();
     ss << "Player " << static_cast<int>(player.id) << ": " << player.score
        << " points";
     if (player.id == localPlayerId) {
@@ -433,38 +435,41 @@ void Renderer::renderGameEndScreen(sf::RenderWindow *window,
     }
 
     playerText.setString(ss.str());
-    playerText.setCharacterSize(20);
-
-    if (player.id == localPlayerId) {
-      playerText.setFillColor(sf::Color::Yellow);
-    } else {
-      playerText.setFillColor(sf::Color::White);
-    }
+    playerText.setFillColor(player.id == localPlayerId ? sf::Color::Yellow
+                                                       : sf::Color::White);
 
     sf::FloatRect playerBounds = playerText.getLocalBounds();
     playerText.setPosition(virtualWidth_ / 2.0f - playerBounds.width / 2.0f,
                            yOffset);
-
-    window->draw(playerText);
+    playerText.draw(target);
     yOffset += 30;
   }
 
-  sf::Text countdownText;
-  countdownText.setFont(font);
-  countdownText.setString("Closing in " + std::to_string(timeLeft) +
-                          " seconds...");
-  countdownText.setCharacterSize(24);
-  countdownText.setFillColor(sf::Color::White);
-
-  sf::FloatRect countdownBounds = countdownText.getLocalBounds();
-  countdownText.setPosition(virtualWidth_ / 2.0f - countdownBounds.width / 2.0f,
-                            virtualHeight_ - 100);
+  if (countdownText_.setString("Closing in " + std::to_string(timeLeft) +
+                               " seconds...")) {
+    sf::FloatRect countdownBounds = countdownText_.getLocalBounds();
+    countdownText_.setPosition(
+        virtualWidth_ / 2.0f - countdownBounds.width / 2.0f,
+        virtualHeight_ - 100);
+  }
+  countdownText_.draw(target);
+}
 
-  window->draw(countdownText);
+CachedText &Renderer::scoreLabel(uint8_t playerId) {
+  if (playerId >= scoreLabels_.size()) {
+    size_t oldSize = scoreLabels_.size();
+    scoreLabels_.resize(playerId + 1);
+    for (size_t i = oldSize; i < scoreLabels_.size(); i++) {
+      scoreLabels_[i].setup(*font_, 12, sf::Color::White);
+    }
+  }
+  return scoreLabels_[playerId];
 }
 
-void Renderer::setOnCountdownEndCallback(std::function<void()> callback) {
-  onCountdownEndCallback_ = callback;
+std::ostringstream &Renderer::resetTextStream() {
+  textStream_.str(std::string());
+  textStream_.clear();
+  return textStream_;
 }
 
 } // namespace graphics
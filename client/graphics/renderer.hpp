@@ -9,10 +9,21 @@
 #ifndef CLIENT_GRAPHICS_RENDERER_HPP_
 #define CLIENT_GRAPHICS_RENDERER_HPP_
 
+#include "../debug/frame_profiler.hpp"
 #include "../gamestate.hpp"
+#include "dynamic_resolution.hpp"
+#include "frame_context.hpp"
+#include "parallax_background.hpp"
+#include "profiler_overlay.hpp"
+#include "sprite_atlas.hpp"
+#include "sprite_batch.hpp"
+#include "text_cache.hpp"
+#include "tile_map.hpp"
 #include <SFML/Graphics.hpp>
 #include <chrono>
 #include <functional>
+#include <sstream>
+#include <vector>
 
 namespace jetpack {
 namespace graphics {
@@ -23,13 +34,23 @@ public:
   ~Renderer() = default;
 
   bool initialize(sf::Font &font);
+  // Draw a frame and present it; closes the window once the game end
+  // countdown is over
   void render(sf::RenderWindow *window);
-  void handleResize(sf::RenderWindow *window, unsigned int width,
-                    unsigned int height);
+  // Draw a frame into any target without presenting it (offscreen use)
+  void renderFrame(sf::RenderTarget &target);
+  void handleResize(unsigned int width, unsigned int height);
+
+  // Render the world at this fraction of the target resolution instead of
+  // following the frame time
+  void setFixedRenderScale(float scale);
 
   // Callback for when the countdown ends
   void setOnCountdownEndCallback(std::function<void()> callback);
 
+  // Stage timings go to this profiler when it is enabled (may be null)
+  void setProfiler(debug::FrameProfiler *profiler);
+
 private:
   // Core data
   GameState *gameState_;
@@ -38,6 +59,7 @@ private:
 
   // Game end screen properties
   bool gameEndOverlayActive_ = false;
+  bool countdownExpired_ = false;
   std::chrono::time_point<std::chrono::steady_clock> gameEndTime_;
   const int shutdownCountdownSeconds_ = 5;
 
@@ -51,32 +73,69 @@ private:
   const unsigned int virtualHeight_ = 600;
   float cameraOffsetX_ = 0.0f; // Camera offset for scrolling
 
-  // SFML shape objects
-  sf::CircleShape playerShape_;      // Green circle
-  sf::RectangleShape wallShape_;     // Gray square
-  sf::CircleShape coinShape_;        // Yellow circle
-  sf::RectangleShape electricShape_; // Purple rectangle
+  // World render target scaled with the measured frame time
+  DynamicResolution resolution_;
+  sf::Clock frameClock_;
+  const sf::Color CLEAR_COLOR = sf::Color(50, 50, 50);
+
+  // Backdrop scrolled with the camera, drawn in the UI view
+  ParallaxBackground background_;
+
+  // Animated sprites: players, coins and zappers share one atlas and are
+  // drawn with a single batched call per frame
+  SpriteAtlas atlas_;
+  SpriteBatch spriteBatch_;
+  sf::Clock animationClock_;
 
   // Game scale factors
   const float TILE_SIZE = 20.0f;
-  const float PLAYER_RADIUS = 10.0f;
-  const float COIN_RADIUS = 5.0f;
+  const float PLAYER_SIZE = 26.0f;
   const float FIXED_PLAYER_X =
       100.0f; // Position where player stops and world scrolls instead
 
+  // Walls baked per chunk, coins and zappers listed per chunk
+  TileMap tileMap_;
+  uint32_t mapRevision_ = 0;
+
+  // Text kept across frames, re-laid out only when its string changes
+  CachedText statusText_;
+  CachedText debugText_;
+  CachedText connectingText_;
+  CachedText gameOverText_;
+  CachedText scoresTitleText_;
+  CachedText countdownText_;
+  std::vector<CachedText> scoreLabels_;     // Indexed by player ID
+  std::vector<CachedText> finalScoreLines_; // One per player, end screen
+  StaticTextLayer hudLabels_;               // Controls hint
+  std::ostringstream textStream_;           // Reused formatting buffer
+
+  // State read once per frame and shared by the stages below
+  FrameContext frame_;
+  uint32_t probedTick_ = 0; // Last tick reported to the latency probe
+
+  // Frame timings and their debug overlay graph
+  debug::FrameProfiler *profiler_ = nullptr;
+  ProfilerOverlay profilerOverlay_;
+
   // Rendering methods
-  void renderMap(sf::RenderWindow *window);
-  void renderPlayers(sf::RenderWindow *window);
-  void renderUI(sf::RenderWindow *window, const sf::Font &font);
-  void renderDebugInfo(sf::RenderWindow *window, const sf::Font &font);
-  void renderConnectingMessage(sf::RenderWindow *window, const sf::Font &font);
-  void renderGameEndScreen(sf::RenderWindow *window, const sf::Font &font);
+  void renderWorld(sf::RenderTarget &output, const FrameContext &frame);
+  void renderHud(sf::RenderTarget &target, const FrameContext &frame);
+  void renderMap(sf::RenderTarget &target, const FrameContext &frame);
+  void queuePlayers(const FrameContext &frame);
+  void renderScoreLabels(sf::RenderTarget &target, const FrameContext &frame);
+  void renderUI(sf::RenderTarget &target, const FrameContext &frame);
+  void renderDebugInfo(sf::RenderTarget &target, const FrameContext &frame);
+  void renderConnectingMessage(sf::RenderTarget &target);
+  void renderGameEndScreen(sf::RenderTarget &target,
+                           const FrameContext &frame);
+
+  // Score label of a player, created on first use
+  CachedText &scoreLabel(uint8_t playerId);
+  // Empty the reusable formatting buffer
+  std::ostringstream &resetTextStream();
 
   // Helper method to update camera position based on player position
-  void updateCamera();
-
-  // Helper method to convert server coordinates to display coordinates
-  sf::Vector2f convertServerToDisplayCoords(uint16_t serverX, uint16_t serverY);
+  void updateCamera(const FrameContext &frame);
 };
 
 } // namespace graphics
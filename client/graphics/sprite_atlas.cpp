@@ -0,0 +1,118 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Sprite atlas packing implementation
+*/
+
+#include "sprite_atlas.hpp"
+#include "../debug/log.hpp"
+#include <algorithm>
+
+namespace jetpack {
+namespace graphics {
+
+namespace {
+
+// Gap left around each sheet so smoothing never samples a neighbour
+constexpr unsigned int ATLAS_PADDING = 2;
+constexpr unsigned int ATLAS_MAX_WIDTH = 2048;
+
+struct SheetSpec {
+  const char *path;
+  unsigned int columns;
+  unsigned int rows;
+};
+
+enum SheetIndex { SHEET_PLAYER = 0, SHEET_COIN, SHEET_ZAPPER, SHEET_COUNT };
+
+const SheetSpec SHEETS[SHEET_COUNT] = {
+    {"assets/player_sprite_sheet.png", 4, 6},
+    {"assets/coins_sprite_sheet.png", 6, 1},
+    {"assets/zapper_sprite_sheet.png", 4, 1},
+};
+
+struct AnimationSpec {
+  AnimationId id;
+  SheetIndex sheet;
+  unsigned int row;
+  float frameDuration;
+};
+
+const AnimationSpec ANIMATIONS[] = {
+    {AnimationId::PlayerRun, SHEET_PLAYER, 0, 0.1f},
+    {AnimationId::PlayerFly, SHEET_PLAYER, 1, 0.1f},
+    {AnimationId::Coin, SHEET_COIN, 0, 0.08f},
+    {AnimationId::Zapper, SHEET_ZAPPER, 0, 0.06f},
+};
+
+} // namespace
+
+bool SpriteAtlas::load() {
+  sf::Image sheets[SHEET_COUNT];
+  sf::Vector2u origins[SHEET_COUNT];
+
+  for (int i = 0; i < SHEET_COUNT; ++i) {
+    if (!sheets[i].loadFromFile(SHEETS[i].path)) {
+      JETPACK_LOG_WARN("Atlas", "Failed to load " << SHEETS[i].path);
+      return false;
+    }
+  }
+
+  // Shelf packing, tallest sheets first
+  int order[SHEET_COUNT] = {SHEET_PLAYER, SHEET_COIN, SHEET_ZAPPER};
+  std::sort(order, order + SHEET_COUNT, [&sheets](int a, int b) {
+    return sheets[a].getSize().y > sheets[b].getSize().y;
+  });
+
+  unsigned int maxWidth =
+      std::min(ATLAS_MAX_WIDTH, sf::Texture::getMaximumSize());
+  unsigned int cursorX = 0;
+  unsigned int shelfY = 0;
+  unsigned int shelfHeight = 0;
+  unsigned int atlasWidth = 0;
+
+  for (int index : order) {
+    sf::Vector2u size = sheets[index].getSize();
+    if (cursorX > 0 && cursorX + size.x > maxWidth) {
+      shelfY += shelfHeight + ATLAS_PADDING;
+      cursorX = 0;
+      shelfHeight = 0;
+    }
+    origins[index] = sf::Vector2u(cursorX, shelfY);
+    cursorX += size.x + ATLAS_PADDING;
+    shelfHeight = std::max(shelfHeight, size.y);
+    atlasWidth = std::max(atlasWidth, cursorX);
+  }
+
+  sf::Image atlas;
+  atlas.create(atlasWidth, shelfY + shelfHeight, sf::Color::Transparent);
+  for (int i = 0; i < SHEET_COUNT; ++i) {
+    atlas.copy(sheets[i], origins[i].x, origins[i].y);
+  }
+  if (!texture_.loadFromImage(atlas))
+    return false;
+  texture_.setSmooth(true);
+
+  for (const auto &spec : ANIMATIONS) {
+    const SheetSpec &sheet = SHEETS[spec.sheet];
+    sf::Vector2u size = sheets[spec.sheet].getSize();
+    int frameWidth = size.x / sheet.columns;
+    int frameHeight = size.y / sheet.rows;
+    Animation &animation = animations_[static_cast<size_t>(spec.id)];
+
+    animation.frameDuration = spec.frameDuration;
+    animation.frames.clear();
+    for (unsigned int column = 0; column < sheet.columns; ++column) {
+      animation.frames.emplace_back(
+          origins[spec.sheet].x + column * frameWidth,
+          origins[spec.sheet].y + spec.row * frameHeight, frameWidth,
+          frameHeight);
+    }
+  }
+  return true;
+}
+
+} // namespace graphics
+} // namespace jetpack
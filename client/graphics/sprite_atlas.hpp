@@ -0,0 +1,60 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Sprite sheets packed into one texture atlas
+*/
+
+#ifndef CLIENT_GRAPHICS_SPRITE_ATLAS_HPP_
+#define CLIENT_GRAPHICS_SPRITE_ATLAS_HPP_
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace jetpack {
+namespace graphics {
+
+enum class AnimationId : size_t {
+  PlayerRun = 0, // Player sheet, first row
+  PlayerFly,     // Player sheet, second row
+  Coin,
+  Zapper,
+  Count
+};
+
+// Texture rects of one animation inside the atlas
+struct Animation {
+  std::vector<sf::IntRect> frames;
+  float frameDuration = 0.1f; // Seconds per frame
+
+  const sf::IntRect &frameAt(float seconds) const {
+    size_t index = static_cast<size_t>(seconds / frameDuration);
+    return frames[index % frames.size()];
+  }
+};
+
+class SpriteAtlas {
+public:
+  SpriteAtlas() = default;
+  ~SpriteAtlas() = default;
+
+  // Load the sprite sheets from assets/, pack them into a single texture
+  // and precompute every animation frame rect
+  bool load();
+
+  const sf::Texture &getTexture() const { return texture_; }
+  const Animation &getAnimation(AnimationId id) const {
+    return animations_[static_cast<size_t>(id)];
+  }
+
+private:
+  sf::Texture texture_;
+  Animation animations_[static_cast<size_t>(AnimationId::Count)];
+};
+
+} // namespace graphics
+} // namespace jetpack
+
+#endif // CLIENT_GRAPHICS_SPRITE_ATLAS_HPP_
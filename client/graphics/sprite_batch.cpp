@@ -0,0 +1,43 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Sprite batch implementation
+*/
+
+#include "sprite_batch.hpp"
+#include "../debug/frame_profiler.hpp"
+
+namespace jetpack {
+namespace graphics {
+
+void SpriteBatch::add(const sf::FloatRect &dest, const sf::IntRect &source,
+                      const sf::Color &color) {
+  const float right = dest.left + dest.width;
+  const float bottom = dest.top + dest.height;
+  const float u0 = static_cast<float>(source.left);
+  const float v0 = static_cast<float>(source.top);
+  const float u1 = u0 + source.width;
+  const float v1 = v0 + source.height;
+
+  vertices_.append(sf::Vertex(sf::Vector2f(dest.left, dest.top), color,
+                              sf::Vector2f(u0, v0)));
+  vertices_.append(sf::Vertex(sf::Vector2f(right, dest.top), color,
+                              sf::Vector2f(u1, v0)));
+  vertices_.append(sf::Vertex(sf::Vector2f(right, bottom), color,
+                              sf::Vector2f(u1, v1)));
+  vertices_.append(sf::Vertex(sf::Vector2f(dest.left, bottom), color,
+                              sf::Vector2f(u0, v1)));
+}
+
+void SpriteBatch::draw(sf::RenderTarget &target,
+                       const sf::Texture &texture) const {
+  if (vertices_.getVertexCount() == 0)
+    return;
+  target.draw(vertices_, sf::RenderStates(&texture));
+  debug::countDrawCalls();
+}
+
+} // namespace graphics
+} // namespace jetpack
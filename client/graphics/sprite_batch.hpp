@@ -0,0 +1,40 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Per-frame batch of textured quads sharing one atlas
+*/
+
+#ifndef CLIENT_GRAPHICS_SPRITE_BATCH_HPP_
+#define CLIENT_GRAPHICS_SPRITE_BATCH_HPP_
+
+#include <SFML/Graphics.hpp>
+
+namespace jetpack {
+namespace graphics {
+
+class SpriteBatch {
+public:
+  SpriteBatch() : vertices_(sf::Quads) {}
+  ~SpriteBatch() = default;
+
+  // Drop last frame's quads, keeping the vertex storage
+  void clear() { vertices_.clear(); }
+
+  void add(const sf::FloatRect &dest, const sf::IntRect &source,
+           const sf::Color &color = sf::Color::White);
+
+  // Draw every queued quad in a single call
+  void draw(sf::RenderTarget &target, const sf::Texture &texture) const;
+
+  size_t size() const { return vertices_.getVertexCount() / 4; }
+
+private:
+  sf::VertexArray vertices_;
+};
+
+} // namespace graphics
+} // namespace jetpack
+
+#endif // CLIENT_GRAPHICS_SPRITE_BATCH_HPP_
@@ -0,0 +1,79 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Cached and pre-baked text implementation
+*/
+
+#include "text_cache.hpp"
+#include "../debug/frame_profiler.hpp"
+
+namespace jetpack {
+namespace graphics {
+
+void CachedText::setup(const sf::Font &font, unsigned int characterSize,
+                       const sf::Color &color) {
+  text_.setFont(font);
+  text_.setCharacterSize(characterSize);
+  text_.setFillColor(color);
+}
+
+bool CachedText::setString(const std::string &string) {
+  if (string == string_)
+    return false;
+  string_ = string;
+  text_.setString(string_);
+  return true;
+}
+
+void CachedText::setFillColor(const sf::Color &color) {
+  if (text_.getFillColor() != color) {
+    text_.setFillColor(color);
+  }
+}
+
+void CachedText::setPosition(float x, float y) { text_.setPosition(x, y); }
+
+sf::FloatRect CachedText::getLocalBounds() const {
+  return text_.getLocalBounds();
+}
+
+void CachedText::draw(sf::RenderTarget &target) const {
+  target.draw(text_);
+  debug::countDrawCalls();
+}
+
+void StaticTextLayer::addLabel(const sf::Text &label) {
+  labels_.push_back(label);
+  baked_ = false;
+}
+
+bool StaticTextLayer::bake(unsigned int width, unsigned int height) {
+  if (!texture_.create(width, height))
+    return false;
+  texture_.clear(sf::Color::Transparent);
+  for (const auto &label : labels_) {
+    texture_.draw(label);
+  }
+  texture_.display();
+  sprite_.setTexture(texture_.getTexture(), true);
+  baked_ = true;
+  return true;
+}
+
+void StaticTextLayer::draw(sf::RenderTarget &target) const {
+  if (baked_) {
+    target.draw(sprite_);
+    debug::countDrawCalls();
+  } else {
+    // Baking failed (no render texture support), draw the labels directly
+    for (const auto &label : labels_) {
+      target.draw(label);
+    }
+    debug::countDrawCalls(static_cast<uint32_t>(labels_.size()));
+  }
+}
+
+} // namespace graphics
+} // namespace jetpack
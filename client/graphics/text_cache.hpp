@@ -0,0 +1,57 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Cached and pre-baked text for the HUD and overlays
+*/
+
+#ifndef CLIENT_GRAPHICS_TEXT_CACHE_HPP_
+#define CLIENT_GRAPHICS_TEXT_CACHE_HPP_
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace graphics {
+
+// sf::Text that is kept across frames and only re-laid out when its string
+// actually changes
+class CachedText {
+public:
+  void setup(const sf::Font &font, unsigned int characterSize,
+             const sf::Color &color);
+
+  // Returns true when the string differed and the glyphs will be rebuilt
+  bool setString(const std::string &string);
+  void setFillColor(const sf::Color &color);
+  void setPosition(float x, float y);
+
+  sf::FloatRect getLocalBounds() const;
+  void draw(sf::RenderTarget &target) const;
+
+private:
+  sf::Text text_;
+  std::string string_;
+};
+
+// Labels that never change, rendered once into a texture and drawn as a
+// single sprite
+class StaticTextLayer {
+public:
+  void addLabel(const sf::Text &label);
+  bool bake(unsigned int width, unsigned int height);
+  void draw(sf::RenderTarget &target) const;
+
+private:
+  std::vector<sf::Text> labels_;
+  sf::RenderTexture texture_;
+  sf::Sprite sprite_;
+  bool baked_ = false;
+};
+
+} // namespace graphics
+} // namespace jetpack
+
+#endif // CLIENT_GRAPHICS_TEXT_CACHE_HPP_
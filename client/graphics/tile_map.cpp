@@ -0,0 +1,227 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Chunked tile map implementation
+*/
+
+#include "tile_map.hpp"
+#include "../debug/frame_profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace jetpack {
+namespace graphics {
+
+namespace {
+
+constexpr unsigned int ATLAS_SLOT_SIZE = 32;
+
+void fillSlot(sf::Image &image, unsigned int slot, const sf::Color &color) {
+  for (unsigned int y = 0; y < ATLAS_SLOT_SIZE; ++y) {
+    for (unsigned int x = 0; x < ATLAS_SLOT_SIZE; ++x) {
+      image.setPixel(slot * ATLAS_SLOT_SIZE + x, y, color);
+    }
+  }
+}
+
+} // namespace
+
+TileMap::TileMap(float tileSize) : tileSize_(tileSize) {}
+
+bool TileMap::initialize() {
+  sf::Image image;
+  image.create(ATLAS_SLOT_SIZE * SLOT_COUNT, ATLAS_SLOT_SIZE,
+               sf::Color::Transparent);
+
+  fillSlot(image, SLOT_WALL, sf::Color(100, 100, 100));
+
+  if (!atlas_.loadFromImage(image))
+    return false;
+  atlas_.setSmooth(true);
+  return true;
+}
+
+void TileMap::setMap(uint16_t width, uint16_t height,
+                     const std::vector<uint8_t> &mapData) {
+  width_ = width;
+  height_ = height;
+  tiles_ = mapData;
+  tiles_.resize(static_cast<size_t>(width) * height, protocol::EMPTY);
+
+  chunksX_ = (width + CHUNK_TILES - 1) / CHUNK_TILES;
+  chunksY_ = (height + CHUNK_TILES - 1) / CHUNK_TILES;
+  chunks_.clear();
+  chunks_.resize(static_cast<size_t>(chunksX_) * chunksY_);
+  for (auto &chunk : chunks_) {
+    chunk.vertices.setPrimitiveType(sf::Quads);
+  }
+}
+
+void TileMap::syncCoins(const GameState &gameState) {
+  incomingCoins_.revision = coins_.revision;
+  if (!gameState.getCoinSnapshot(&incomingCoins_))
+    return;
+
+  const auto &oldLocal = coins_.local.words();
+  const auto &oldOther = coins_.other.words();
+  const auto &newLocal = incomingCoins_.local.words();
+  const auto &newOther = incomingCoins_.other.words();
+
+  if (oldLocal.size() != newLocal.size()) {
+    for (auto &chunk : chunks_) {
+      chunk.dirty = true;
+    }
+  } else {
+    for (size_t word = 0; word < newLocal.size(); ++word) {
+      uint64_t changed =
+          (oldLocal[word] ^ newLocal[word]) | (oldOther[word] ^ newOther[word]);
+      while (changed) {
+        int bit = __builtin_ctzll(changed);
+        markTileDirty(word * 64 + bit);
+        changed &= changed - 1;
+      }
+    }
+  }
+  std::swap(coins_, incomingCoins_);
+}
+
+void TileMap::markTileDirty(size_t tileIndex) {
+  if (width_ == 0 || tileIndex >= tiles_.size())
+    return;
+  uint16_t tileX = tileIndex % width_;
+  uint16_t tileY = tileIndex / width_;
+  chunks_[(tileY / CHUNK_TILES) * chunksX_ + tileX / CHUNK_TILES].dirty = true;
+}
+
+TileMap::ChunkRange TileMap::visibleChunks(const sf::View &view) const {
+  const float chunkSize = CHUNK_TILES * tileSize_;
+  sf::Vector2f topLeft = view.getCenter() - view.getSize() * 0.5f;
+  sf::Vector2f bottomRight = view.getCenter() + view.getSize() * 0.5f;
+  int firstX = static_cast<int>(std::floor(topLeft.x / chunkSize));
+  int firstY = static_cast<int>(std::floor(topLeft.y / chunkSize));
+  int lastX = static_cast<int>(std::floor(bottomRight.x / chunkSize));
+  int lastY = static_cast<int>(std::floor(bottomRight.y / chunkSize));
+
+  return {std::max(0, firstX), std::max(0, firstY),
+          std::min(chunksX_ - 1, lastX), std::min(chunksY_ - 1, lastY)};
+}
+
+void TileMap::draw(sf::RenderTarget &target, const sf::View &view) {
+  if (chunks_.empty())
+    return;
+
+  ChunkRange range = visibleChunks(view);
+  sf::RenderStates states(&atlas_);
+  for (int cy = range.firstY; cy <= range.lastY; ++cy) {
+    for (int cx = range.firstX; cx <= range.lastX; ++cx) {
+      Chunk &chunk = chunks_[cy * chunksX_ + cx];
+      if (chunk.dirty) {
+        rebuildChunk(cx, cy);
+      }
+      if (chunk.vertices.getVertexCount() > 0) {
+        target.draw(chunk.vertices, states);
+        debug::countDrawCalls();
+      }
+    }
+  }
+}
+
+void TileMap::appendAnimated(SpriteBatch &batch, const sf::View &view,
+                             const sf::IntRect &coinFrame,
+                             const sf::IntRect &zapperFrame) {
+  if (chunks_.empty())
+    return;
+
+  // Coins the local player already took stay visible, dimmed
+  const sf::Color takenTint(150, 150, 150, 160);
+  ChunkRange range = visibleChunks(view);
+  for (int cy = range.firstY; cy <= range.lastY; ++cy) {
+    for (int cx = range.firstX; cx <= range.lastX; ++cx) {
+      Chunk &chunk = chunks_[cy * chunksX_ + cx];
+      if (chunk.dirty) {
+        rebuildChunk(cx, cy);
+      }
+      for (const auto &tile : chunk.animated) {
+        switch (tile.kind) {
+        case ANIMATED_COIN:
+          batch.add(tile.rect, coinFrame);
+          break;
+        case ANIMATED_COIN_TAKEN:
+          batch.add(tile.rect, coinFrame, takenTint);
+          break;
+        case ANIMATED_ZAPPER:
+          batch.add(tile.rect, zapperFrame);
+          break;
+        }
+      }
+    }
+  }
+}
+
+void TileMap::rebuildChunk(uint16_t chunkX, uint16_t chunkY) {
+  Chunk &chunk = chunks_[chunkY * chunksX_ + chunkX];
+  const float coinSize = tileSize_ * 0.8f;
+  const float coinInset = (tileSize_ - coinSize) / 2.0f;
+
+  chunk.vertices.clear();
+  chunk.animated.clear();
+  uint16_t endX = std::min<int>(width_, (chunkX + 1) * CHUNK_TILES);
+  uint16_t endY = std::min<int>(height_, (chunkY + 1) * CHUNK_TILES);
+
+  for (uint16_t y = chunkY * CHUNK_TILES; y < endY; ++y) {
+    for (uint16_t x = chunkX * CHUNK_TILES; x < endX; ++x) {
+      sf::FloatRect tileRect(x * tileSize_, y * tileSize_, tileSize_,
+                             tileSize_);
+
+      switch (tiles_[static_cast<size_t>(y) * width_ + x]) {
+      case protocol::WALL:
+        appendQuad(chunk.vertices, tileRect, SLOT_WALL);
+        break;
+      case protocol::COIN: {
+        bool collectedByLocalPlayer = coins_.local.test(x, y);
+        bool collectedByOtherPlayer = coins_.other.test(x, y);
+
+        if (collectedByLocalPlayer && collectedByOtherPlayer)
+          break;
+        chunk.animated.push_back(
+            {sf::FloatRect(tileRect.left + coinInset, tileRect.top + coinInset,
+                           coinSize, coinSize),
+             collectedByLocalPlayer ? ANIMATED_COIN_TAKEN : ANIMATED_COIN});
+        break;
+      }
+      case protocol::ELECTRIC:
+        chunk.animated.push_back({tileRect, ANIMATED_ZAPPER});
+        break;
+      default:
+        break;
+      }
+    }
+  }
+  chunk.dirty = false;
+}
+
+void TileMap::appendQuad(sf::VertexArray &vertices, const sf::FloatRect &rect,
+                         AtlasSlot slot) {
+  // Sample half a texel inside the slot so smoothing never bleeds neighbours
+  const float u0 = slot * ATLAS_SLOT_SIZE + 0.5f;
+  const float u1 = (slot + 1) * ATLAS_SLOT_SIZE - 0.5f;
+  const float v0 = 0.5f;
+  const float v1 = ATLAS_SLOT_SIZE - 0.5f;
+  const float right = rect.left + rect.width;
+  const float bottom = rect.top + rect.height;
+
+  vertices.append(sf::Vertex(sf::Vector2f(rect.left, rect.top),
+                             sf::Vector2f(u0, v0)));
+  vertices.append(
+      sf::Vertex(sf::Vector2f(right, rect.top), sf::Vector2f(u1, v0)));
+  vertices.append(
+      sf::Vertex(sf::Vector2f(right, bottom), sf::Vector2f(u1, v1)));
+  vertices.append(
+      sf::Vertex(sf::Vector2f(rect.left, bottom), sf::Vector2f(u0, v1)));
+}
+
+} // namespace graphics
+} // namespace jetpack
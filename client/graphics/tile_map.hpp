@@ -0,0 +1,99 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Chunked tile map baked into vertex arrays
+*/
+
+#ifndef CLIENT_GRAPHICS_TILE_MAP_HPP_
+#define CLIENT_GRAPHICS_TILE_MAP_HPP_
+
+#include "../gamestate.hpp"
+#include "sprite_batch.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace jetpack {
+namespace graphics {
+
+class TileMap {
+public:
+  explicit TileMap(float tileSize);
+  ~TileMap() = default;
+
+  bool initialize();
+
+  // Replace the map; every chunk is rebuilt lazily on its next draw
+  void setMap(uint16_t width, uint16_t height,
+              const std::vector<uint8_t> &mapData);
+
+  // Pull this frame's coin bitmaps and flag chunks whose coins changed
+  void syncCoins(const GameState &gameState);
+
+  // Draw the wall chunks overlapping the view, rebuilding dirty ones first
+  void draw(sf::RenderTarget &target, const sf::View &view);
+
+  // Queue the coins and zappers of the chunks overlapping the view, using
+  // this frame's animation rects
+  void appendAnimated(SpriteBatch &batch, const sf::View &view,
+                      const sf::IntRect &coinFrame,
+                      const sf::IntRect &zapperFrame);
+
+  static constexpr uint16_t CHUNK_TILES = 32;
+
+private:
+  enum AnimatedKind : uint8_t {
+    ANIMATED_COIN,
+    ANIMATED_COIN_TAKEN,
+    ANIMATED_ZAPPER
+  };
+
+  struct AnimatedTile {
+    sf::FloatRect rect;
+    AnimatedKind kind;
+  };
+
+  struct Chunk {
+    sf::VertexArray vertices;
+    std::vector<AnimatedTile> animated; // Coins still shown, zappers
+    bool dirty = true;
+  };
+
+  // Chunk coordinates overlapping a view, inclusive
+  struct ChunkRange {
+    int firstX;
+    int firstY;
+    int lastX;
+    int lastY;
+  };
+
+  // Atlas slots, one tile graphic each
+  enum AtlasSlot : unsigned int { SLOT_WALL = 0, SLOT_COUNT = 1 };
+
+  const float tileSize_;
+  sf::Texture atlas_;
+
+  uint16_t width_ = 0;
+  uint16_t height_ = 0;
+  uint16_t chunksX_ = 0;
+  uint16_t chunksY_ = 0;
+  std::vector<uint8_t> tiles_;
+  std::vector<Chunk> chunks_;
+
+  // Coin bitmaps the chunks were built from, plus a swap buffer
+  CoinSnapshot coins_;
+  CoinSnapshot incomingCoins_;
+
+  ChunkRange visibleChunks(const sf::View &view) const;
+  void markTileDirty(size_t tileIndex);
+  void rebuildChunk(uint16_t chunkX, uint16_t chunkY);
+  void appendQuad(sf::VertexArray &vertices, const sf::FloatRect &rect,
+                  AtlasSlot slot);
+};
+
+} // namespace graphics
+} // namespace jetpack
+
+#endif // CLIENT_GRAPHICS_TILE_MAP_HPP_
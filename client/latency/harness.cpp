@@ -0,0 +1,111 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Loopback harness implementation
+*/
+
+#include "harness.hpp"
+#include <chrono>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+namespace jetpack {
+namespace latency {
+
+namespace {
+
+// Time left to the server to listen before the client connects
+constexpr auto SERVER_STARTUP = std::chrono::milliseconds(300);
+// Time left to a child between SIGINT and SIGKILL
+constexpr auto STOP_GRACE = std::chrono::seconds(2);
+
+} // namespace
+
+LatencyHarness::LatencyHarness(const HarnessConfig &config)
+    : config_(config) {}
+
+LatencyHarness::~LatencyHarness() {
+  terminate(&client_);
+  terminate(&server_);
+}
+
+bool LatencyHarness::run(const std::atomic<bool> &stopRequested) {
+  std::string port = std::to_string(config_.port);
+
+  server_ = spawn({config_.serverPath, "-p", port, "-m", config_.mapPath,
+                   "-n", "1", "-L", config_.serverProbePath});
+  std::this_thread::sleep_for(SERVER_STARTUP);
+  if (server_ < 0 || exited(&server_)) {
+    error_ = "Cannot start " + config_.serverPath;
+    return false;
+  }
+  client_ = spawn({config_.clientPath, "-h", "127.0.0.1", "-p", port, "-L",
+                   config_.clientProbePath, "-j",
+                   std::to_string(config_.injectPeriodMs)});
+  if (client_ < 0) {
+    error_ = "Cannot start " + config_.clientPath;
+    terminate(&server_);
+    return false;
+  }
+
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::seconds(config_.durationSeconds);
+  while (!stopRequested && std::chrono::steady_clock::now() < deadline &&
+         !exited(&client_)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  terminate(&client_);
+  terminate(&server_);
+  return true;
+}
+
+// The report goes to stdout, so the children only keep their stderr
+pid_t LatencyHarness::spawn(const std::vector<std::string> &args) {
+  std::vector<char *> argv;
+  pid_t pid;
+
+  for (const auto &arg : args)
+    argv.push_back(const_cast<char *>(arg.c_str()));
+  argv.push_back(nullptr);
+  pid = fork();
+  if (pid == 0) {
+    int null = open("/dev/null", O_WRONLY);
+    if (null >= 0)
+      dup2(null, STDOUT_FILENO);
+    execv(argv[0], argv.data());
+    _exit(127);
+  }
+  return pid;
+}
+
+bool LatencyHarness::exited(pid_t *pid) {
+  if (*pid <= 0)
+    return true;
+  if (waitpid(*pid, nullptr, WNOHANG) != *pid)
+    return false;
+  *pid = -1;
+  return true;
+}
+
+void LatencyHarness::terminate(pid_t *pid) {
+  if (exited(pid))
+    return;
+  kill(*pid, SIGINT);
+  auto deadline = std::chrono::steady_clock::now() + STOP_GRACE;
+  while (std::chrono::steady_clock::now() < deadline) {
+    if (exited(pid))
+      return;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+  kill(*pid, SIGKILL);
+  waitpid(*pid, nullptr, 0);
+  *pid = -1;
+}
+
+} // namespace latency
+} // namespace jetpack
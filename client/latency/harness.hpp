@@ -0,0 +1,57 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Launches a probed server and client on loopback
+*/
+
+#ifndef CLIENT_LATENCY_HARNESS_HPP_
+#define CLIENT_LATENCY_HARNESS_HPP_
+
+#include <atomic>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+namespace jetpack {
+namespace latency {
+
+struct HarnessConfig {
+  std::string serverPath = "./jetpack_server";
+  std::string clientPath = "./jetpack_client";
+  std::string mapPath;
+  int port = 4343;
+  int durationSeconds = 20;
+  int injectPeriodMs = 300; // Jetpack toggled every 1 to 2 periods
+  std::string serverProbePath = "latency_server.csv";
+  std::string clientProbePath = "latency_client.csv";
+};
+
+class LatencyHarness {
+public:
+  explicit LatencyHarness(const HarnessConfig &config);
+  ~LatencyHarness();
+
+  // Start a one-player server and a client toggling its jetpack, play until
+  // the duration elapses, the client exits or stopRequested is set, then
+  // stop both. The probe files are left for LatencyReport
+  bool run(const std::atomic<bool> &stopRequested);
+
+  const std::string &error() const { return error_; }
+
+private:
+  HarnessConfig config_;
+  pid_t server_ = -1;
+  pid_t client_ = -1;
+  std::string error_;
+
+  pid_t spawn(const std::vector<std::string> &args);
+  bool exited(pid_t *pid);
+  void terminate(pid_t *pid);
+};
+
+} // namespace latency
+} // namespace jetpack
+
+#endif // CLIENT_LATENCY_HARNESS_HPP_
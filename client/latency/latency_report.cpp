@@ -0,0 +1,182 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Input-to-photon latency report implementation
+*/
+
+#include "latency_report.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+namespace jetpack {
+namespace latency {
+
+namespace {
+
+// The reversal is in the GAME_STATE of the tick that applied the change,
+// later only when the server skips states (admin send_every)
+constexpr uint32_t MAX_TICK_SLACK = 4;
+
+struct Query {
+  const char *event;
+  int player; // -1 matches any
+  int value;  // -1 matches any
+  uint64_t afterNs;
+  uint32_t minTick;
+};
+
+const ProbeEvent *findEvent(const std::vector<ProbeEvent> &events,
+                            const Query &query) {
+  auto it = std::lower_bound(events.begin(), events.end(), query.afterNs,
+                             [](const ProbeEvent &event, uint64_t time) {
+                               return event.timeNs < time;
+                             });
+
+  for (; it != events.end(); ++it) {
+    if (it->event != query.event || it->tick < query.minTick)
+      continue;
+    if ((query.player < 0 || it->player == query.player) &&
+        (query.value < 0 || it->value == query.value))
+      return &*it;
+  }
+  return nullptr;
+}
+
+double elapsedMs(const ProbeEvent &from, const ProbeEvent &to) {
+  return to.timeNs > from.timeNs ? (to.timeNs - from.timeNs) / 1e6 : 0.0;
+}
+
+} // namespace
+
+const char *LatencyReport::stageName(Stage stage) {
+  switch (stage) {
+  case Stage::InputQueue:
+    return "input_queue";
+  case Stage::Network:
+    return "network";
+  case Stage::TickWait:
+    return "tick_wait";
+  case Stage::SnapshotDelivery:
+    return "snapshot";
+  case Stage::Render:
+    return "render";
+  default:
+    return "total";
+  }
+}
+
+void LatencyReport::build(const std::vector<ProbeEvent> &client,
+                          const std::vector<ProbeEvent> &server) {
+  for (size_t i = 0; i < client.size(); i++) {
+    if (client[i].event != "inject")
+      continue;
+    injected_++;
+    if (follow(client, server, i))
+      matched_++;
+  }
+}
+
+bool LatencyReport::follow(const std::vector<ProbeEvent> &client,
+                           const std::vector<ProbeEvent> &server,
+                           size_t inject) {
+  const ProbeEvent &start = client[inject];
+  uint64_t nextInject = std::numeric_limits<uint64_t>::max();
+
+  for (size_t i = inject + 1; i < client.size(); i++) {
+    if (client[i].event == "inject") {
+      nextInject = client[i].timeNs;
+      break;
+    }
+  }
+  // Undone by the next injection before the network thread sent it
+  const ProbeEvent *sent =
+      findEvent(client, {"input_sent", -1, start.value, start.timeNs, 0});
+  if (!sent || sent->timeNs >= nextInject)
+    return false;
+
+  int player = sent->player;
+  const ProbeEvent *arrival = findEvent(
+      server, {"input_arrival", player, start.value, sent->timeNs, 0});
+  const ProbeEvent *read =
+      arrival ? findEvent(server, {"input_read", player, start.value,
+                                   arrival->timeNs, 0})
+              : nullptr;
+  const ProbeEvent *step =
+      read ? findEvent(server,
+                       {"step", player, start.value, read->timeNs, 0})
+           : nullptr;
+  const ProbeEvent *received =
+      step ? findEvent(client, {"state_rx", player, start.value,
+                                step->timeNs, step->tick})
+           : nullptr;
+  if (!received || received->tick > step->tick + MAX_TICK_SLACK)
+    return false;
+  const ProbeEvent *frame = findEvent(
+      client, {"frame", -1, -1, received->timeNs, received->tick});
+  if (!frame)
+    return false;
+
+  auto record = [this](Stage stage, double ms) {
+    stages_[static_cast<size_t>(stage)].add(ms);
+  };
+  record(Stage::InputQueue, elapsedMs(start, *sent));
+  record(Stage::Network, elapsedMs(*sent, *arrival));
+  record(Stage::TickWait, elapsedMs(*arrival, *step));
+  record(Stage::SnapshotDelivery, elapsedMs(*step, *received));
+  record(Stage::Render, elapsedMs(*received, *frame));
+  record(Stage::Total, elapsedMs(start, *frame));
+  return true;
+}
+
+void LatencyReport::print(std::ostream &out) {
+  char line[160];
+
+  std::snprintf(line, sizeof(line),
+                "%zu jetpack changes injected, %zu seen on screen\n",
+                injected_, matched_);
+  out << line;
+  std::snprintf(line, sizeof(line), "%-12s %9s %9s %9s %9s %9s\n", "stage",
+                "p50 ms", "p90 ms", "p99 ms", "max ms", "mean ms");
+  out << line;
+  for (size_t i = 0; i < STAGE_COUNT; i++) {
+    loadgen::SampleStats &stats = stages_[i];
+    std::snprintf(line, sizeof(line), "%-12s %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+                  stageName(static_cast<Stage>(i)), stats.percentile(0.50),
+                  stats.percentile(0.90), stats.percentile(0.99), stats.max(),
+                  stats.mean());
+    out << line;
+  }
+}
+
+bool LatencyReport::writeJson(const std::string &path) {
+  std::ofstream out(path);
+
+  if (!out)
+    return false;
+  out << "{\n  \"suite\": \"jetpack_latency\",\n"
+      << "  \"timestamp\": " << std::time(nullptr) << ",\n"
+      << "  \"injected\": " << injected_ << ",\n"
+      << "  \"matched\": " << matched_ << ",\n  \"stages\": [";
+  out << std::fixed << std::setprecision(3);
+  for (size_t i = 0; i < STAGE_COUNT; i++) {
+    loadgen::SampleStats &stats = stages_[i];
+    out << (i ? ",\n" : "\n") << "    {\"name\": \""
+        << stageName(static_cast<Stage>(i))
+        << "\", \"mean_ms\": " << stats.mean()
+        << ", \"p50_ms\": " << stats.percentile(0.50)
+        << ", \"p90_ms\": " << stats.percentile(0.90)
+        << ", \"p99_ms\": " << stats.percentile(0.99)
+        << ", \"max_ms\": " << stats.max() << "}";
+  }
+  out << "\n  ]\n}\n";
+  return static_cast<bool>(out);
+}
+
+} // namespace latency
+} // namespace jetpack
@@ -0,0 +1,64 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Input-to-photon latency split from the client and server probes
+*/
+
+#ifndef CLIENT_LATENCY_LATENCY_REPORT_HPP_
+#define CLIENT_LATENCY_LATENCY_REPORT_HPP_
+
+#include "../loadgen/sample_stats.hpp"
+#include "probe_log.hpp"
+#include <array>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace latency {
+
+// Consecutive parts of one jetpack change, Total spans all of them
+enum class Stage {
+  InputQueue,       // Injected key -> CLIENT_INPUT written (20 Hz sends)
+  Network,          // CLIENT_INPUT written -> received by the server kernel
+  TickWait,         // Waiting in the socket for a tick, then sim_step()
+  SnapshotDelivery, // sim_step() -> GAME_STATE showing the new motion
+  Render,           // GAME_STATE decoded -> first frame of that tick shown
+  Total,
+  Count
+};
+
+constexpr size_t STAGE_COUNT = static_cast<size_t>(Stage::Count);
+
+class LatencyReport {
+public:
+  /**
+   * Follow every injected jetpack change through both logs; changes that
+   * never showed up as a reversal of the local player are counted apart
+   */
+  void build(const std::vector<ProbeEvent> &client,
+             const std::vector<ProbeEvent> &server);
+
+  void print(std::ostream &out);
+  bool writeJson(const std::string &path);
+
+  size_t injected() const { return injected_; }
+  size_t matched() const { return matched_; }
+
+  static const char *stageName(Stage stage);
+
+private:
+  std::array<loadgen::SampleStats, STAGE_COUNT> stages_;
+  size_t injected_ = 0;
+  size_t matched_ = 0;
+
+  bool follow(const std::vector<ProbeEvent> &client,
+              const std::vector<ProbeEvent> &server, size_t inject);
+};
+
+} // namespace latency
+} // namespace jetpack
+
+#endif // CLIENT_LATENCY_LATENCY_REPORT_HPP_
@@ -0,0 +1,130 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Input-to-photon latency harness entrypoint
+*/
+
+#include "harness.hpp"
+#include "latency_report.hpp"
+#include "probe_log.hpp"
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <string>
+
+namespace {
+
+std::atomic<bool> g_stop_requested(false);
+
+void signal_handler(int) { g_stop_requested = true; }
+
+void print_usage(const char *program_name) {
+  std::cout << "Usage: " << program_name
+            << " -m <map> [-s <server>] [-c <client>] [-p <port>]"
+               " [-t <seconds>] [-j <ms>] [-o <report.json>]"
+            << std::endl;
+  std::cout << "       " << program_name
+            << " -A [-o <report.json>]" << std::endl;
+  std::cout << "  -m <map>      Map given to the server" << std::endl;
+  std::cout << "  -s <server>   Server binary (default ./jetpack_server)"
+            << std::endl;
+  std::cout << "  -c <client>   Client binary (default ./jetpack_client, "
+               "needs a display: use xvfb-run)"
+            << std::endl;
+  std::cout << "  -p <port>     Loopback port (default 4343)" << std::endl;
+  std::cout << "  -t <seconds>  Length of the run (default 20)" << std::endl;
+  std::cout << "  -j <ms>       Jetpack toggled every <ms> to 2 * <ms> "
+               "(default 300)"
+            << std::endl;
+  std::cout << "  -A            Only analyse latency_client.csv and "
+               "latency_server.csv"
+            << std::endl;
+  std::cout << "                (from jetpack_client -L and "
+               "jetpack_server -L run by hand)"
+            << std::endl;
+  std::cout << "  -o <file>     Write the report as JSON" << std::endl;
+}
+
+bool parse_int(const char *text, int min, int *value) {
+  try {
+    *value = std::stoi(text);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return *value >= min;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  jetpack::latency::HarnessConfig config;
+  std::string outputPath;
+  bool analyseOnly = false;
+  bool valid = true;
+
+  for (int i = 1; i < argc && valid; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+
+    if (arg == "-m" && hasValue) {
+      config.mapPath = argv[++i];
+    } else if (arg == "-s" && hasValue) {
+      config.serverPath = argv[++i];
+    } else if (arg == "-c" && hasValue) {
+      config.clientPath = argv[++i];
+    } else if (arg == "-p" && hasValue) {
+      valid = parse_int(argv[++i], 1024, &config.port) &&
+              config.port <= 65535;
+    } else if (arg == "-t" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.durationSeconds);
+    } else if (arg == "-j" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.injectPeriodMs);
+    } else if (arg == "-o" && hasValue) {
+      outputPath = argv[++i];
+    } else if (arg == "-A") {
+      analyseOnly = true;
+    } else {
+      valid = false;
+    }
+  }
+  if (!valid || (!analyseOnly && config.mapPath.empty())) {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  std::signal(SIGINT, signal_handler);
+  std::signal(SIGTERM, signal_handler);
+
+  if (!analyseOnly) {
+    jetpack::latency::LatencyHarness harness(config);
+    std::cout << "Running " << config.clientPath << " against "
+              << config.serverPath << " for " << config.durationSeconds
+              << " s" << std::endl;
+    if (!harness.run(g_stop_requested)) {
+      std::cerr << "Error: " << harness.error() << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<jetpack::latency::ProbeEvent> client;
+  std::vector<jetpack::latency::ProbeEvent> server;
+  std::string error;
+  if (!jetpack::latency::loadProbeLog(config.clientProbePath, &client,
+                                      &error) ||
+      !jetpack::latency::loadProbeLog(config.serverProbePath, &server,
+                                      &error)) {
+    std::cerr << "Error: " << error << std::endl;
+    return 1;
+  }
+
+  jetpack::latency::LatencyReport report;
+  report.build(client, server);
+  report.print(std::cout);
+  if (!outputPath.empty() && !report.writeJson(outputPath)) {
+    std::cerr << "Error: Cannot write " << outputPath << std::endl;
+    return 1;
+  }
+  return report.matched() > 0 ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Probe file reader implementation
+*/
+
+#include "probe_log.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace jetpack {
+namespace latency {
+
+namespace {
+
+bool parseLine(const std::string &line, ProbeEvent *event) {
+  std::istringstream fields(line);
+  std::string player;
+  std::string value;
+  std::string tick;
+  std::string time;
+
+  if (!std::getline(fields, event->event, ',') ||
+      !std::getline(fields, player, ',') ||
+      !std::getline(fields, value, ',') || !std::getline(fields, tick, ',') ||
+      !std::getline(fields, time)) {
+    return false;
+  }
+  try {
+    event->player = std::stoi(player);
+    event->value = std::stoi(value);
+    event->tick = static_cast<uint32_t>(std::stoul(tick));
+    event->timeNs = std::stoull(time);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+bool loadProbeLog(const std::string &path, std::vector<ProbeEvent> *events,
+                  std::string *error) {
+  std::ifstream in(path);
+  std::string line;
+  size_t lineNumber = 1;
+
+  if (!in || !std::getline(in, line)) {
+    *error = "Cannot read " + path;
+    return false;
+  }
+  events->clear();
+  while (std::getline(in, line)) {
+    ProbeEvent event;
+
+    lineNumber++;
+    if (line.empty())
+      continue;
+    if (!parseLine(line, &event)) {
+      *error = path + ":" + std::to_string(lineNumber) + ": malformed line";
+      return false;
+    }
+    events->push_back(event);
+  }
+  // Client threads stamp their events before taking the file lock
+  std::stable_sort(events->begin(), events->end(),
+                   [](const ProbeEvent &a, const ProbeEvent &b) {
+                     return a.timeNs < b.timeNs;
+                   });
+  return true;
+}
+
+} // namespace latency
+} // namespace jetpack
@@ -0,0 +1,38 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Reader of the client and server latency probe files
+*/
+
+#ifndef CLIENT_LATENCY_PROBE_LOG_HPP_
+#define CLIENT_LATENCY_PROBE_LOG_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace latency {
+
+// One line of jetpack_client -L or jetpack_server -L
+struct ProbeEvent {
+  std::string event;
+  int player = -1;
+  int value = 0;
+  uint32_t tick = 0;
+  uint64_t timeNs = 0; // CLOCK_MONOTONIC
+};
+
+/**
+ * Load every event of a probe file, sorted by time. False with error set
+ * when the file cannot be read or a line is malformed
+ */
+bool loadProbeLog(const std::string &path, std::vector<ProbeEvent> *events,
+                  std::string *error);
+
+} // namespace latency
+} // namespace jetpack
+
+#endif // CLIENT_LATENCY_PROBE_LOG_HPP_
@@ -0,0 +1,142 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** One simulated player: a Network connection driven by an input script
+*/
+
+#include "bot.hpp"
+#include <cstdlib>
+
+namespace jetpack {
+namespace loadgen {
+
+namespace {
+
+constexpr size_t PLAYER_DATA_SIZE = 9;
+
+int64_t toNanoseconds(Bot::Clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+double millisecondsBetween(Bot::Clock::time_point from,
+                           Bot::Clock::time_point to) {
+  return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+} // namespace
+
+Bot::Bot(const std::string &host, int port, const InputScript &script)
+    : network_(host, port, false, &gameState_), script_(script) {
+  network_.setPacketObserver([this](const protocol::PacketHeader &header,
+                                    const std::vector<uint8_t> &payload) {
+    onPacket(header, payload);
+  });
+}
+
+bool Bot::start() {
+  connectStart_ = Clock::now();
+  if (!network_.connect())
+    return false;
+  network_.run();
+  return true;
+}
+
+void Bot::update(Clock::time_point now) {
+  if (!gameState_.isGameRunning())
+    return;
+  if (!matchStarted_) {
+    matchStarted_ = true;
+    matchStart_ = now;
+  }
+
+  int64_t elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          now - matchStart_)
+                          .count();
+  bool jetpack = script_.jetpackAt(elapsedMs);
+  if (jetpack == jetpack_)
+    return;
+
+  jetpack_ = jetpack;
+  gameState_.setJetpackActive(jetpack);
+  if (pendingFlip_.exchange(toNanoseconds(now) * 2 + jetpack) != 0)
+    supersededFlips_++;
+}
+
+void Bot::stop() {
+  network_.stop();
+  stats_.unresolvedInputs = supersededFlips_.load();
+  if (pendingFlip_.load() != 0)
+    stats_.unresolvedInputs++;
+}
+
+void Bot::onPacket(const protocol::PacketHeader &header,
+                   const std::vector<uint8_t> &payload) {
+  Clock::time_point now = Clock::now();
+
+  if (stats_.packetsReceived == 0)
+    firstPacket_ = now;
+  stats_.packetsReceived++;
+  stats_.bytesReceived += sizeof(header) + payload.size();
+  stats_.activeSeconds =
+      std::chrono::duration<double>(now - firstPacket_).count();
+
+  switch (header.type) {
+  case protocol::SERVER_WELCOME:
+    stats_.welcomed = true;
+    stats_.connectMs = millisecondsBetween(connectStart_, now);
+    break;
+  case protocol::GAME_STATE:
+    onGameState(payload, now);
+    break;
+  default:
+    break;
+  }
+}
+
+void Bot::onGameState(const std::vector<uint8_t> &payload,
+                      Clock::time_point now) {
+  if (lastSnapshot_ != Clock::time_point()) {
+    double intervalMs = millisecondsBetween(lastSnapshot_, now);
+    stats_.snapshotIntervalMs.add(intervalMs);
+    if (lastIntervalMs_ >= 0.0)
+      stats_.snapshotJitterMs.add(std::abs(intervalMs - lastIntervalMs_));
+    lastIntervalMs_ = intervalMs;
+  }
+  lastSnapshot_ = now;
+
+  if (payload.size() < 5)
+    return;
+  uint8_t me = gameState_.getAssignedId();
+  for (size_t i = 0; i < payload[4]; i++) {
+    size_t offset = 5 + i * PLAYER_DATA_SIZE;
+    if (offset + PLAYER_DATA_SIZE > payload.size())
+      return;
+    if (payload[offset] != me || !payload[offset + 7])
+      continue;
+    int y = (payload[offset + 3] << 8) | payload[offset + 4];
+    if (lastY_ >= 0)
+      resolveInput(y - lastY_, now);
+    lastY_ = y;
+    return;
+  }
+}
+
+void Bot::resolveInput(int deltaY, Clock::time_point now) {
+  // The jetpack lifts the player (y shrinks), gravity pulls it back down
+  int64_t pending = pendingFlip_.load();
+  if (pending == 0)
+    return;
+  bool jetpack = pending & 1;
+  if ((jetpack && deltaY >= 0) || (!jetpack && deltaY <= 0))
+    return;
+  if (!pendingFlip_.compare_exchange_strong(pending, 0))
+    return;
+  stats_.inputLatencyMs.add((toNanoseconds(now) - pending / 2) / 1e6);
+}
+
+} // namespace loadgen
+} // namespace jetpack
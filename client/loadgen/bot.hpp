@@ -0,0 +1,86 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** One simulated player: a Network connection driven by an input script
+*/
+
+#ifndef CLIENT_LOADGEN_BOT_HPP_
+#define CLIENT_LOADGEN_BOT_HPP_
+
+#include "../gamestate.hpp"
+#include "../network/network.hpp"
+#include "input_script.hpp"
+#include "sample_stats.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace loadgen {
+
+struct BotStats {
+  bool welcomed = false;
+  double connectMs = 0.0; // connect() until SERVER_WELCOME
+  SampleStats snapshotIntervalMs;
+  SampleStats snapshotJitterMs; // |interval - previous interval|
+  SampleStats inputLatencyMs;   // Input flip until GAME_STATE reflects it
+  uint32_t unresolvedInputs = 0;
+  uint64_t packetsReceived = 0;
+  uint64_t bytesReceived = 0;
+  double activeSeconds = 0.0; // First to last received packet
+};
+
+class Bot {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  Bot(const std::string &host, int port, const InputScript &script);
+  ~Bot() = default;
+
+  // Connect and start the network thread
+  bool start();
+  // Follow the input script once the match runs; main thread only
+  void update(Clock::time_point now);
+  void stop();
+
+  bool gameEnded() const { return gameState_.hasGameEnded(); }
+  // Written by the network thread, only read it after stop()
+  const BotStats &stats() const { return stats_; }
+
+private:
+  GameState gameState_;
+  network::Network network_;
+  const InputScript &script_;
+  BotStats stats_;
+
+  // Main-thread state
+  Clock::time_point connectStart_;
+  Clock::time_point matchStart_;
+  bool matchStarted_ = false;
+  bool jetpack_ = false;
+
+  // Last input flip not yet seen in a GAME_STATE: time in ns * 2 plus the
+  // new jetpack state, 0 when none is pending
+  std::atomic<int64_t> pendingFlip_{0};
+  std::atomic<uint32_t> supersededFlips_{0};
+
+  // Network-thread state
+  Clock::time_point firstPacket_;
+  Clock::time_point lastSnapshot_;
+  double lastIntervalMs_ = -1.0;
+  int lastY_ = -1;
+
+  void onPacket(const protocol::PacketHeader &header,
+                const std::vector<uint8_t> &payload);
+  void onGameState(const std::vector<uint8_t> &payload, Clock::time_point now);
+  void resolveInput(int deltaY, Clock::time_point now);
+};
+
+} // namespace loadgen
+} // namespace jetpack
+
+#endif // CLIENT_LOADGEN_BOT_HPP_
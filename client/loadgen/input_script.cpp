@@ -0,0 +1,70 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Looping jetpack on/off timeline followed by a load-generator bot
+*/
+
+#include "input_script.hpp"
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace jetpack {
+namespace loadgen {
+
+bool InputScript::loadFile(const std::string &path) {
+  std::ifstream file(path);
+  if (!file)
+    return false;
+
+  steps_.clear();
+  std::string line;
+  while (std::getline(file, line)) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream fields(line);
+    int64_t atMs;
+    int state;
+    if (!(fields >> atMs))
+      continue;
+    if (!(fields >> state) || atMs < 0 ||
+        (!steps_.empty() && atMs < steps_.back().atMs))
+      return false;
+    steps_.push_back({atMs, state != 0});
+  }
+  if (steps_.empty())
+    return false;
+  lengthMs_ = steps_.back().atMs + 1;
+  return true;
+}
+
+void InputScript::randomize(uint32_t seed, int64_t lengthMs) {
+  // Holds of 80-600 ms roughly match a human tapping the jetpack key
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int64_t> hold(80, 600);
+
+  steps_.clear();
+  bool jetpack = rng() & 1;
+  for (int64_t at = 0; at < lengthMs; at += hold(rng)) {
+    steps_.push_back({at, jetpack});
+    jetpack = !jetpack;
+  }
+  lengthMs_ = lengthMs;
+}
+
+bool InputScript::jetpackAt(int64_t elapsedMs) const {
+  if (steps_.empty())
+    return false;
+  int64_t at = elapsedMs % lengthMs_;
+  bool jetpack = steps_.front().jetpack;
+  for (const auto &step : steps_) {
+    if (step.atMs > at)
+      break;
+    jetpack = step.jetpack;
+  }
+  return jetpack;
+}
+
+} // namespace loadgen
+} // namespace jetpack
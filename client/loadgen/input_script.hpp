@@ -0,0 +1,43 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Looping jetpack on/off timeline followed by a load-generator bot
+*/
+
+#ifndef CLIENT_LOADGEN_INPUT_SCRIPT_HPP_
+#define CLIENT_LOADGEN_INPUT_SCRIPT_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace loadgen {
+
+class InputScript {
+public:
+  // Lines of "<milliseconds> <0|1>", '#' starts a comment; the last time is
+  // the loop length. Returns false when the file is missing or malformed
+  bool loadFile(const std::string &path);
+
+  // Toggle the jetpack at random intervals over a lengthMs loop
+  void randomize(uint32_t seed, int64_t lengthMs);
+
+  bool jetpackAt(int64_t elapsedMs) const;
+
+private:
+  struct Step {
+    int64_t atMs;
+    bool jetpack;
+  };
+
+  std::vector<Step> steps_;
+  int64_t lengthMs_ = 0;
+};
+
+} // namespace loadgen
+} // namespace jetpack
+
+#endif // CLIENT_LOADGEN_INPUT_SCRIPT_HPP_
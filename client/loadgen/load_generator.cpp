@@ -0,0 +1,142 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Runs many headless bots against one server and reports percentiles
+*/
+
+#include "load_generator.hpp"
+#include <cstdio>
+#include <iostream>
+#include <thread>
+
+namespace jetpack {
+namespace loadgen {
+
+namespace {
+
+constexpr int64_t RANDOM_SCRIPT_MS = 60000;
+constexpr auto UPDATE_PERIOD = std::chrono::milliseconds(5);
+
+void printRow(std::ostream &out, const char *name, SampleStats &stats) {
+  char line[128];
+  std::snprintf(line, sizeof(line), "%-24s %9.2f %9.2f %9.2f %9.2f %9zu\n",
+                name, stats.percentile(0.50), stats.percentile(0.95),
+                stats.percentile(0.99), stats.max(), stats.count());
+  out << line;
+}
+
+} // namespace
+
+LoadGenerator::LoadGenerator(const LoadConfig &config) : config_(config) {}
+
+bool LoadGenerator::prepareScripts() {
+  if (!config_.scriptPath.empty()) {
+    scripts_.resize(1);
+    return scripts_[0].loadFile(config_.scriptPath);
+  }
+  scripts_.resize(config_.clients);
+  for (int i = 0; i < config_.clients; i++) {
+    scripts_[i].randomize(config_.seed + i, RANDOM_SCRIPT_MS);
+  }
+  return true;
+}
+
+bool LoadGenerator::allMatchesEnded() const {
+  for (const auto &bot : bots_) {
+    if (!bot->gameEnded())
+      return false;
+  }
+  return !bots_.empty();
+}
+
+bool LoadGenerator::run(const std::atomic<bool> &stopRequested) {
+  if (!prepareScripts()) {
+    std::cerr << "Error: Cannot read input script " << config_.scriptPath
+              << std::endl;
+    return false;
+  }
+
+  auto start = Bot::Clock::now();
+  for (int i = 0; i < config_.clients && !stopRequested; i++) {
+    const InputScript &script = scripts_[scripts_.size() == 1 ? 0 : i];
+    auto bot = std::make_unique<Bot>(config_.host, config_.port, script);
+    if (!bot->start()) {
+      std::cerr << "Bot " << i << " failed to connect" << std::endl;
+      continue;
+    }
+    bots_.push_back(std::move(bot));
+    connected_++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(config_.rampMs));
+  }
+
+  auto deadline = start + std::chrono::seconds(config_.durationSeconds);
+  while (!stopRequested && !allMatchesEnded() &&
+         Bot::Clock::now() < deadline) {
+    auto now = Bot::Clock::now();
+    for (auto &bot : bots_) {
+      bot->update(now);
+    }
+    std::this_thread::sleep_for(UPDATE_PERIOD);
+  }
+
+  for (auto &bot : bots_) {
+    bot->stop();
+  }
+  elapsedSeconds_ =
+      std::chrono::duration<double>(Bot::Clock::now() - start).count();
+  return connected_ > 0;
+}
+
+void LoadGenerator::printReport(std::ostream &out) {
+  SampleStats connect;
+  SampleStats interval;
+  SampleStats jitter;
+  SampleStats latency;
+  SampleStats throughput;
+  uint64_t packets = 0;
+  uint64_t bytes = 0;
+  uint32_t unresolved = 0;
+  int welcomed = 0;
+
+  for (const auto &bot : bots_) {
+    const BotStats &stats = bot->stats();
+    if (stats.welcomed) {
+      welcomed++;
+      connect.add(stats.connectMs);
+    }
+    interval.merge(stats.snapshotIntervalMs);
+    jitter.merge(stats.snapshotJitterMs);
+    latency.merge(stats.inputLatencyMs);
+    if (stats.activeSeconds > 0.0)
+      throughput.add(stats.bytesReceived / 1024.0 / stats.activeSeconds);
+    packets += stats.packetsReceived;
+    bytes += stats.bytesReceived;
+    unresolved += stats.unresolvedInputs;
+  }
+
+  char line[160];
+  std::snprintf(line, sizeof(line),
+                "%d/%d bots connected, %d welcomed, %.1f s\n", connected_,
+                config_.clients, welcomed, elapsedSeconds_);
+  out << line;
+  std::snprintf(line, sizeof(line), "%-24s %9s %9s %9s %9s %9s\n", "metric",
+                "p50", "p95", "p99", "max", "samples");
+  out << line;
+  printRow(out, "connect (ms)", connect);
+  printRow(out, "snapshot interval (ms)", interval);
+  printRow(out, "snapshot jitter (ms)", jitter);
+  printRow(out, "input to state (ms)", latency);
+  printRow(out, "rx per bot (KiB/s)", throughput);
+  std::snprintf(line, sizeof(line),
+                "received %llu packets, %.1f KiB (%.1f packets/s, %.1f "
+                "KiB/s); %u inputs never seen in a GAME_STATE\n",
+                static_cast<unsigned long long>(packets), bytes / 1024.0,
+                packets / elapsedSeconds_, bytes / 1024.0 / elapsedSeconds_,
+                unresolved);
+  out << line;
+}
+
+} // namespace loadgen
+} // namespace jetpack
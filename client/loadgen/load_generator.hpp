@@ -0,0 +1,57 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Runs many headless bots against one server and reports percentiles
+*/
+
+#ifndef CLIENT_LOADGEN_LOAD_GENERATOR_HPP_
+#define CLIENT_LOADGEN_LOAD_GENERATOR_HPP_
+
+#include "bot.hpp"
+#include "input_script.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace loadgen {
+
+struct LoadConfig {
+  std::string host;
+  int port = 0;
+  int clients = 2;
+  int durationSeconds = 30;
+  int rampMs = 10;         // Delay between two connections
+  std::string scriptPath;  // Shared input script, random per bot if empty
+  uint32_t seed = 1;
+};
+
+class LoadGenerator {
+public:
+  explicit LoadGenerator(const LoadConfig &config);
+
+  // Connect every bot, play until the duration elapses, every match ends
+  // or stopRequested is set, then stop them. False when no bot connected
+  bool run(const std::atomic<bool> &stopRequested);
+  void printReport(std::ostream &out);
+
+private:
+  LoadConfig config_;
+  std::vector<InputScript> scripts_; // Filled before any bot refers to it
+  std::vector<std::unique_ptr<Bot>> bots_;
+  int connected_ = 0;
+  double elapsedSeconds_ = 0.0;
+
+  bool prepareScripts();
+  bool allMatchesEnded() const;
+};
+
+} // namespace loadgen
+} // namespace jetpack
+
+#endif // CLIENT_LOADGEN_LOAD_GENERATOR_HPP_
@@ -0,0 +1,103 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Headless load generator entrypoint
+*/
+
+#include "../debug/log.hpp"
+#include "load_generator.hpp"
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <string>
+
+namespace {
+
+std::atomic<bool> g_stop_requested(false);
+
+void signal_handler(int) { g_stop_requested = true; }
+
+void print_usage(const char *program_name) {
+  std::cout << "Usage: " << program_name
+            << " -h <host> -p <port> [-n <bots>] [-t <seconds>]"
+               " [-i <script>] [-r <ramp ms>] [-x <seed>] [-v]"
+            << std::endl;
+  std::cout << "  -n <bots>     Connections to open (default 2, start the "
+               "server with the same -n)"
+            << std::endl;
+  std::cout << "  -t <seconds>  Stop after this long (default 30)"
+            << std::endl;
+  std::cout << "  -i <script>   Jetpack timeline, lines of \"<ms> <0|1>\"; "
+               "random per bot otherwise"
+            << std::endl;
+  std::cout << "  -r <ramp ms>  Delay between two connections (default 10)"
+            << std::endl;
+  std::cout << "  -x <seed>     Seed of the random timelines (default 1)"
+            << std::endl;
+  std::cout << "  -v            Log protocol warnings" << std::endl;
+}
+
+bool parse_int(const char *text, int min, int *value) {
+  try {
+    *value = std::stoi(text);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return *value >= min;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  jetpack::loadgen::LoadConfig config;
+  int seed = 1;
+  bool verbose = false;
+  bool valid = true;
+
+  for (int i = 1; i < argc && valid; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+
+    if (arg == "-h" && hasValue) {
+      config.host = argv[++i];
+    } else if (arg == "-p" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.port) && config.port <= 65535;
+    } else if (arg == "-n" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.clients);
+    } else if (arg == "-t" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.durationSeconds);
+    } else if (arg == "-i" && hasValue) {
+      config.scriptPath = argv[++i];
+    } else if (arg == "-r" && hasValue) {
+      valid = parse_int(argv[++i], 0, &config.rampMs);
+    } else if (arg == "-x" && hasValue) {
+      valid = parse_int(argv[++i], 0, &seed);
+    } else if (arg == "-v") {
+      verbose = true;
+    } else {
+      valid = false;
+    }
+  }
+  if (!valid || config.host.empty() || config.port <= 0) {
+    print_usage(argv[0]);
+    return 1;
+  }
+  config.seed = static_cast<uint32_t>(seed);
+
+  jetpack::debug::setLogLevel(verbose ? jetpack::debug::Level::Info
+                                      : jetpack::debug::Level::Error);
+  std::signal(SIGINT, signal_handler);
+  std::signal(SIGTERM, signal_handler);
+  std::signal(SIGPIPE, SIG_IGN);
+
+  jetpack::loadgen::LoadGenerator generator(config);
+  if (!generator.run(g_stop_requested)) {
+    std::cerr << "Error: No bot could connect to " << config.host << ":"
+              << config.port << std::endl;
+    return 1;
+  }
+  generator.printReport(std::cout);
+  return 0;
+}
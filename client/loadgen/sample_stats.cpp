@@ -0,0 +1,55 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Sample set with percentile queries for the load generator
+*/
+
+#include "sample_stats.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace jetpack {
+namespace loadgen {
+
+void SampleStats::add(double value) {
+  sorted_ = sorted_ && (values_.empty() || value >= values_.back());
+  values_.push_back(value);
+  sum_ += value;
+}
+
+void SampleStats::merge(const SampleStats &other) {
+  values_.insert(values_.end(), other.values_.begin(), other.values_.end());
+  sum_ += other.sum_;
+  sorted_ = false;
+}
+
+double SampleStats::mean() const {
+  return values_.empty() ? 0.0 : sum_ / values_.size();
+}
+
+double SampleStats::percentile(double fraction) {
+  if (values_.empty())
+    return 0.0;
+  sort();
+  size_t rank = static_cast<size_t>(std::ceil(fraction * values_.size()));
+  return values_[std::min(values_.size() - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+double SampleStats::max() {
+  if (values_.empty())
+    return 0.0;
+  sort();
+  return values_.back();
+}
+
+void SampleStats::sort() {
+  if (!sorted_) {
+    std::sort(values_.begin(), values_.end());
+    sorted_ = true;
+  }
+}
+
+} // namespace loadgen
+} // namespace jetpack
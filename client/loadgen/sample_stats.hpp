@@ -0,0 +1,40 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Sample set with percentile queries for the load generator
+*/
+
+#ifndef CLIENT_LOADGEN_SAMPLE_STATS_HPP_
+#define CLIENT_LOADGEN_SAMPLE_STATS_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace jetpack {
+namespace loadgen {
+
+class SampleStats {
+public:
+  void add(double value);
+  void merge(const SampleStats &other);
+
+  size_t count() const { return values_.size(); }
+  double mean() const;
+  // Nearest-rank percentile, fraction in [0, 1]; 0 when empty
+  double percentile(double fraction);
+  double max();
+
+private:
+  std::vector<double> values_;
+  double sum_ = 0.0;
+  bool sorted_ = true;
+
+  void sort();
+};
+
+} // namespace loadgen
+} // namespace jetpack
+
+#endif // CLIENT_LOADGEN_SAMPLE_STATS_HPP_
@@ -7,20 +7,28 @@
 */
 
 #include "debug/debug.hpp"
+#include "debug/latency_probe.hpp"
+#include "debug/log.hpp"
+#include "debug/trace.hpp"
 #include "gamestate.hpp"
 #include "graphics/graphics.hpp"
+#include "graphics/render_benchmark.hpp"
 #include "network/network.hpp"
+#include "replay/replay_player.hpp"
 #include <atomic>
 #include <chrono>
 #include <csignal>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <string>
 #include <thread>
 
 // Global variables for the main application components
 jetpack::network::Network *g_network = nullptr;
 jetpack::graphics::Graphics *g_graphics = nullptr;
+jetpack::replay::ReplayPlayer *g_replay = nullptr;
 bool g_debug_mode = false;
 std::atomic<bool> g_window_closed(false);
 std::atomic<bool> g_countdown_ended(false);
@@ -39,6 +47,10 @@ void signal_handler(int signal) {
     g_network->stop();
   }
 
+  if (g_replay) {
+    g_replay->stop();
+  }
+
   if (g_graphics) {
     g_graphics->stop();
   }
@@ -47,12 +59,45 @@ void signal_handler(int signal) {
 }
 
 void print_usage(const char *program_name) {
-  std::cout << "Usage: " << program_name << " -h <host> -p <port> [-d]"
+  std::cout << "Usage: " << program_name
+            << " -h <host> -p <port> [-d] [-t <file>] [-L <probe.csv>]"
+               " [-j <ms>]"
+            << std::endl;
+  std::cout << "       " << program_name
+            << " -r <replay> [-s <speed>] [-d] [-t <file>]" << std::endl;
+  std::cout << "       " << program_name
+            << " -r <replay> -B [-g <width>x<height>] [-n <passes>]"
+               " [-o <report.json>]"
             << std::endl;
   std::cout << "  -h <host>   Server hostname or IP" << std::endl;
   std::cout << "  -p <port>   Server port" << std::endl;
   std::cout << "  -d          Enable debug mode (verbose protocol logging)"
             << std::endl;
+  std::cout << "  -t <file>   Write a Chrome trace of the client threads"
+            << std::endl;
+  std::cout << "  -L <file>   Log input-to-photon probes as CSV (see "
+               "jetpack_latency)"
+            << std::endl;
+  std::cout << "  -j <ms>     Toggle the jetpack every <ms> to 2 * <ms> "
+               "(latency harness)"
+            << std::endl;
+  std::cout << "  -r <replay> Play a match recorded with jetpack_server -r"
+            << std::endl;
+  std::cout << "  -s <speed>  Replay speed factor (default 1)" << std::endl;
+  std::cout << "Replay keys: Left/Right seek 5s, Up/Down double/halve the "
+               "speed, P pause, Home restart"
+            << std::endl;
+  std::cout << "  -B          Render the replay offscreen as fast as possible "
+               "and report frame times"
+            << std::endl;
+  std::cout << "              (software GL unless LIBGL_ALWAYS_SOFTWARE is "
+               "set; use xvfb-run without a display)"
+            << std::endl;
+  std::cout << "  -g <WxH>    Benchmark resolution (default 1280x720)"
+            << std::endl;
+  std::cout << "  -n <passes> Times the replay is rendered (default 1)"
+            << std::endl;
+  std::cout << "  -o <file>   Write the benchmark report as JSON" << std::endl;
 }
 
 void handle_window_closed() {
@@ -78,10 +123,125 @@ void handle_countdown_end() {
   g_window_closed = true;
 }
 
+void handle_replay_key(sf::Keyboard::Key key) {
+  if (!g_replay)
+    return;
+
+  switch (key) {
+  case sf::Keyboard::Left:
+    g_replay->seekBySeconds(-5.0);
+    break;
+  case sf::Keyboard::Right:
+    g_replay->seekBySeconds(5.0);
+    break;
+  case sf::Keyboard::Up:
+    g_replay->setSpeed(g_replay->getSpeed() * 2);
+    break;
+  case sf::Keyboard::Down:
+    g_replay->setSpeed(g_replay->getSpeed() / 2);
+    break;
+  case sf::Keyboard::P:
+    g_replay->togglePause();
+    break;
+  case sf::Keyboard::Home:
+    g_replay->seekTo(0);
+    break;
+  default:
+    break;
+  }
+}
+
+// Latency harness (-j): toggles the jetpack after a random delay in
+// [period, 2 * period) so the changes do not lock onto the input send rate
+// or the server tick
+void run_input_injector(jetpack::graphics::Graphics *graphics,
+                        const jetpack::GameState *gameState, int period_ms) {
+  std::minstd_rand random(static_cast<uint32_t>(period_ms));
+  std::uniform_int_distribution<int> delay(period_ms, 2 * period_ms - 1);
+  bool pressed = false;
+
+  while (graphics->isRunning() && !g_window_closed) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(delay(random)));
+    if (!gameState->isGameRunning() || gameState->hasGameEnded())
+      continue;
+    pressed = !pressed;
+    graphics->injectKey(sf::Keyboard::Space, pressed);
+  }
+}
+
+// Replays drive the game state from a file, no server involved
+int run_replay(const std::string &path, double speed, bool debug_mode) {
+  jetpack::replay::ReplayReader reader;
+
+  if (!reader.open(path)) {
+    JETPACK_LOG_ERROR("Replay", reader.error());
+    return 1;
+  }
+  std::cout << "Replaying " << path << ": ticks " << reader.firstTick()
+            << "-" << reader.lastTick() << ", "
+            << reader.header().player_count << " players" << std::endl;
+
+  auto gameState = std::make_unique<jetpack::GameState>();
+  auto graphics = std::make_unique<jetpack::graphics::Graphics>(
+      gameState.get(), debug_mode);
+  auto player = std::make_unique<jetpack::replay::ReplayPlayer>(
+      &reader, gameState.get());
+
+  g_graphics = graphics.get();
+  g_replay = player.get();
+  graphics->setOnWindowClosedCallback(handle_window_closed);
+  graphics->setOnKeyPressedCallback(handle_replay_key);
+  player->setSpeed(speed);
+  player->run();
+  graphics->run();
+
+  while (graphics->isRunning() && !g_window_closed) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  player->stop();
+  graphics->stop();
+  g_replay = nullptr;
+  g_graphics = nullptr;
+  return 0;
+}
+
+int run_render_benchmark(
+    const jetpack::graphics::RenderBenchmarkOptions &options) {
+  jetpack::replay::ReplayReader reader;
+
+  if (!reader.open(options.replayPath)) {
+    JETPACK_LOG_ERROR("Replay", reader.error());
+    return 1;
+  }
+  // Results must not depend on the GPU of the machine running them
+  setenv("LIBGL_ALWAYS_SOFTWARE", "1", 0);
+
+  jetpack::graphics::RenderBenchmark benchmark(&reader, options);
+  if (!benchmark.run()) {
+    JETPACK_LOG_ERROR("Benchmark", benchmark.error());
+    return 1;
+  }
+  benchmark.printReport(std::cout);
+  if (!options.outputPath.empty() &&
+      !benchmark.writeJson(options.outputPath)) {
+    JETPACK_LOG_ERROR("Benchmark", "Cannot write " << options.outputPath);
+    return 1;
+  }
+  return 0;
+}
+
 int main(int argc, char *argv[]) {
   std::string host;
   int port = 0;
   bool debug_mode = false;
+  std::string trace_path;
+  std::string probe_path;
+  int inject_period_ms = 0;
+  std::string replay_path;
+  double replay_speed = 1.0;
+  bool render_benchmark = false;
+  jetpack::graphics::RenderBenchmarkOptions benchmark_options;
 
   for (int i = 1; i < argc; i++) {
     std::string arg = argv[i];
@@ -103,13 +263,64 @@ int main(int argc, char *argv[]) {
       }
     } else if (arg == "-d") {
       debug_mode = true;
+    } else if (arg == "-t" && i + 1 < argc) {
+      trace_path = argv[++i];
+    } else if (arg == "-L" && i + 1 < argc) {
+      probe_path = argv[++i];
+    } else if (arg == "-j" && i + 1 < argc) {
+      inject_period_ms = std::atoi(argv[++i]);
+      if (inject_period_ms <= 0) {
+        std::cerr << "Error: Injection period must be a positive number"
+                  << std::endl;
+        print_usage(argv[0]);
+        return 1;
+      }
+    } else if (arg == "-r" && i + 1 < argc) {
+      replay_path = argv[++i];
+    } else if (arg == "-B") {
+      render_benchmark = true;
+    } else if (arg == "-g" && i + 1 < argc) {
+      if (std::sscanf(argv[++i], "%ux%u", &benchmark_options.width,
+                      &benchmark_options.height) != 2 ||
+          benchmark_options.width == 0 || benchmark_options.height == 0) {
+        std::cerr << "Error: Resolution must look like 1280x720" << std::endl;
+        print_usage(argv[0]);
+        return 1;
+      }
+    } else if (arg == "-n" && i + 1 < argc) {
+      benchmark_options.passes = std::atoi(argv[++i]);
+      if (benchmark_options.passes <= 0) {
+        std::cerr << "Error: Passes must be a positive number" << std::endl;
+        print_usage(argv[0]);
+        return 1;
+      }
+    } else if (arg == "-o" && i + 1 < argc) {
+      benchmark_options.outputPath = argv[++i];
+    } else if (arg == "-s" && i + 1 < argc) {
+      try {
+        replay_speed = std::stod(argv[++i]);
+      } catch (const std::exception &e) {
+        replay_speed = 0;
+      }
+      if (replay_speed <= 0) {
+        std::cerr << "Error: Replay speed must be a positive number"
+                  << std::endl;
+        print_usage(argv[0]);
+        return 1;
+      }
     } else {
       print_usage(argv[0]);
       return 1;
     }
   }
 
-  if (host.empty() || port <= 0) {
+  if (render_benchmark && replay_path.empty()) {
+    std::cerr << "Error: -B needs a replay (-r)" << std::endl;
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  if (replay_path.empty() && (host.empty() || port <= 0)) {
     std::cerr << "Error: Host and port are required" << std::endl;
     print_usage(argv[0]);
     return 1;
@@ -117,6 +328,8 @@ int main(int argc, char *argv[]) {
 
   // Set global debug flag
   g_debug_mode = debug_mode;
+  jetpack::debug::setLogLevel(debug_mode ? jetpack::debug::Level::Trace
+                                         : jetpack::debug::Level::Error);
 
   if (debug_mode) {
     std::cout
@@ -132,11 +345,44 @@ int main(int argc, char *argv[]) {
     }
   }
 
+  if (!trace_path.empty()) {
+    if (jetpack::debug::startTrace(trace_path)) {
+      jetpack::debug::setTraceThreadName("main");
+      std::cout << "Tracing client threads to " << trace_path << std::endl;
+    } else {
+      std::cerr << "Warning: Cannot open trace file " << trace_path
+                << std::endl;
+    }
+  }
+
+  if (!probe_path.empty() &&
+      !jetpack::debug::startLatencyProbe(probe_path)) {
+    std::cerr << "Warning: Cannot open probe file " << probe_path
+              << std::endl;
+  }
+
   // Set up signal handlers
   std::signal(SIGINT, signal_handler);
   std::signal(SIGTERM, signal_handler);
 
   try {
+    if (render_benchmark) {
+      benchmark_options.replayPath = replay_path;
+      int status = run_render_benchmark(benchmark_options);
+
+      jetpack::debug::stopTrace();
+      jetpack::debug::shutdownLogging();
+      return status;
+    }
+
+    if (!replay_path.empty()) {
+      int status = run_replay(replay_path, replay_speed, debug_mode);
+
+      jetpack::debug::stopTrace();
+      jetpack::debug::shutdownLogging();
+      return status;
+    }
+
     // Initialize core game components
     auto gameState = std::make_unique<jetpack::GameState>();
 
@@ -158,7 +404,8 @@ int main(int argc, char *argv[]) {
     std::cout << "Connecting to " << host << ":" << port << std::endl;
 
     if (!network->connect()) {
-      std::cerr << "Failed to connect to server" << std::endl;
+      JETPACK_LOG_ERROR("Main", "Failed to connect to server");
+      jetpack::debug::stopTrace();
       jetpack::debug::shutdownLogging();
       return 1;
     }
@@ -173,10 +420,19 @@ int main(int argc, char *argv[]) {
           "Main", "Network and graphics systems initialized", debug_mode);
     }
 
+    std::thread injector;
+    if (inject_period_ms > 0) {
+      injector = std::thread(run_input_injector, graphics.get(),
+                             gameState.get(), inject_period_ms);
+    }
+
     // Main application loop
     while (graphics->isRunning() && !g_window_closed) {
       std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
+    if (injector.joinable()) {
+      injector.join();
+    }
 
     // Clean shutdown
     if (g_window_closed) {
@@ -189,11 +445,17 @@ int main(int argc, char *argv[]) {
       network->stop();
     }
 
+    // Join the render thread so its last spans are in the trace
+    graphics->stop();
+    jetpack::debug::stopTrace();
+    jetpack::debug::stopLatencyProbe();
+
     jetpack::debug::print("Main", "Client shutting down normally", debug_mode);
     jetpack::debug::shutdownLogging();
 
   } catch (const std::exception &e) {
-    std::cerr << "Exception: " << e.what() << std::endl;
+    JETPACK_LOG_ERROR("Main", "Exception: " << e.what());
+    jetpack::debug::stopTrace();
     jetpack::debug::shutdownLogging();
     return 1;
   }
@@ -0,0 +1,61 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Per-direction latency, jitter, bandwidth, drop and reorder model
+*/
+
+#include "link_shaper.hpp"
+#include "../protocol.hpp"
+#include <algorithm>
+
+namespace jetpack {
+namespace netsim {
+
+LinkShaper::LinkShaper(const Impairment &impairment, uint32_t seed)
+    : impairment_(impairment), random_(seed) {}
+
+bool LinkShaper::roll(double percent) {
+  if (percent <= 0)
+    return false;
+  return std::uniform_real_distribution<double>(0.0, 100.0)(random_) <
+         percent;
+}
+
+Clock::duration LinkShaper::latency() {
+  int jitter = 0;
+  if (impairment_.jitterMs > 0) {
+    jitter = std::uniform_int_distribution<int>(-impairment_.jitterMs,
+                                                impairment_.jitterMs)(random_);
+  }
+  return std::chrono::milliseconds(std::max(0, impairment_.delayMs + jitter));
+}
+
+Decision LinkShaper::schedule(uint8_t type, size_t bytes,
+                              Clock::time_point arrival) {
+  bool superseded =
+      type == protocol::GAME_STATE || type == protocol::CLIENT_INPUT;
+
+  if (superseded && roll(impairment_.dropPercent))
+    return {Action::Dropped, arrival};
+
+  linkFree_ = std::max(linkFree_, arrival);
+  if (impairment_.bandwidthKbps > 0) {
+    // kbit/s is bits per millisecond
+    linkFree_ += std::chrono::microseconds(
+        bytes * 8 * 1000 / static_cast<size_t>(impairment_.bandwidthKbps));
+  }
+  Clock::time_point deliverAt = linkFree_ + latency();
+
+  if (superseded && roll(impairment_.reorderPercent)) {
+    return {Action::Reordered,
+            std::max(deliverAt, lastInOrder_) +
+                std::chrono::milliseconds(REORDER_HOLD_MS)};
+  }
+  lastInOrder_ = std::max(deliverAt, lastInOrder_);
+  return {Action::Forwarded, lastInOrder_};
+}
+
+} // namespace netsim
+} // namespace jetpack
@@ -0,0 +1,62 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Per-direction latency, jitter, bandwidth, drop and reorder model
+*/
+
+#ifndef CLIENT_NETSIM_LINK_SHAPER_HPP_
+#define CLIENT_NETSIM_LINK_SHAPER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace jetpack {
+namespace netsim {
+
+using Clock = std::chrono::steady_clock;
+
+struct Impairment {
+  int delayMs = 0;
+  int jitterMs = 0;          // Uniform in [-jitter, +jitter] around delay
+  int bandwidthKbps = 0;     // 0 for an unlimited link
+  double dropPercent = 0;    // Only for packets the next one supersedes
+  double reorderPercent = 0; // Same packets, held back past later ones
+};
+
+enum class Action { Forwarded, Dropped, Reordered };
+
+struct Decision {
+  Action action;
+  Clock::time_point deliverAt;
+};
+
+// MJP runs over TCP, so only GAME_STATE and CLIENT_INPUT, which the next
+// packet of the same type fully replaces, may be dropped or reordered;
+// everything else keeps its order and only pays latency and bandwidth
+class LinkShaper {
+public:
+  LinkShaper(const Impairment &impairment, uint32_t seed);
+
+  Decision schedule(uint8_t type, size_t bytes, Clock::time_point arrival);
+
+  // Extra hold of a reordered packet, one server tick
+  static constexpr int REORDER_HOLD_MS = 50;
+
+private:
+  Impairment impairment_;
+  std::mt19937 random_;
+  Clock::time_point linkFree_;    // End of the previous packet on the wire
+  Clock::time_point lastInOrder_; // Delivery time of the previous packet
+
+  bool roll(double percent);
+  Clock::duration latency();
+};
+
+} // namespace netsim
+} // namespace jetpack
+
+#endif // CLIENT_NETSIM_LINK_SHAPER_HPP_
@@ -0,0 +1,126 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Network impairment proxy entrypoint
+*/
+
+#include "proxy.hpp"
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <string>
+
+namespace {
+
+std::atomic<bool> g_stop_requested(false);
+
+void signal_handler(int) { g_stop_requested = true; }
+
+void print_usage(const char *program_name) {
+  std::cout << "Usage: " << program_name
+            << " -l <listen port> -h <host> -p <port> [-d <ms>] [-j <ms>]"
+               " [-b <kbit/s>] [-L <%>] [-R <%>] [-s up|down|both]"
+               " [-x <seed>] [-o <log.csv>]"
+            << std::endl;
+  std::cout << "  -l <port>     Port the clients connect to, on 127.0.0.1"
+            << std::endl;
+  std::cout << "  -d <ms>       One-way latency (default 0)" << std::endl;
+  std::cout << "  -j <ms>       Jitter, uniform around the latency"
+            << std::endl;
+  std::cout << "  -b <kbit/s>   Bandwidth cap, 0 for none" << std::endl;
+  std::cout << "  -L <%>        Drop rate of GAME_STATE and CLIENT_INPUT"
+            << std::endl;
+  std::cout << "  -R <%>        Reorder rate of the same packets, held back "
+               "one tick"
+            << std::endl;
+  std::cout << "  -s <side>     Directions impaired (default both)"
+            << std::endl;
+  std::cout << "  -x <seed>     Seed of the drop, reorder and jitter draws "
+               "(default 1)"
+            << std::endl;
+  std::cout << "  -o <file>     Per-packet timing log (CSV)" << std::endl;
+}
+
+bool parse_int(const char *text, int min, int *value) {
+  try {
+    *value = std::stoi(text);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return *value >= min;
+}
+
+bool parse_percent(const char *text, double *value) {
+  try {
+    *value = std::stod(text);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return *value >= 0 && *value <= 100;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  jetpack::netsim::ProxyConfig config;
+  jetpack::netsim::Impairment impairment;
+  std::string side = "both";
+  int seed = 1;
+  bool valid = true;
+
+  for (int i = 1; i < argc && valid; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+
+    if (arg == "-l" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.listenPort);
+    } else if (arg == "-h" && hasValue) {
+      config.host = argv[++i];
+    } else if (arg == "-p" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.port) && config.port <= 65535;
+    } else if (arg == "-d" && hasValue) {
+      valid = parse_int(argv[++i], 0, &impairment.delayMs);
+    } else if (arg == "-j" && hasValue) {
+      valid = parse_int(argv[++i], 0, &impairment.jitterMs);
+    } else if (arg == "-b" && hasValue) {
+      valid = parse_int(argv[++i], 0, &impairment.bandwidthKbps);
+    } else if (arg == "-L" && hasValue) {
+      valid = parse_percent(argv[++i], &impairment.dropPercent);
+    } else if (arg == "-R" && hasValue) {
+      valid = parse_percent(argv[++i], &impairment.reorderPercent);
+    } else if (arg == "-s" && hasValue) {
+      side = argv[++i];
+      valid = side == "up" || side == "down" || side == "both";
+    } else if (arg == "-x" && hasValue) {
+      valid = parse_int(argv[++i], 0, &seed);
+    } else if (arg == "-o" && hasValue) {
+      config.logPath = argv[++i];
+    } else {
+      valid = false;
+    }
+  }
+  if (!valid || config.host.empty() || config.port <= 0 ||
+      config.listenPort <= 0 || config.listenPort > 65535) {
+    print_usage(argv[0]);
+    return 1;
+  }
+  if (side != "down")
+    config.upstream = impairment;
+  if (side != "up")
+    config.downstream = impairment;
+  config.seed = static_cast<uint32_t>(seed);
+
+  std::signal(SIGINT, signal_handler);
+  std::signal(SIGTERM, signal_handler);
+  std::signal(SIGPIPE, SIG_IGN);
+
+  jetpack::netsim::Proxy proxy(config);
+  if (!proxy.listen())
+    return 1;
+  std::cout << "Forwarding 127.0.0.1:" << config.listenPort << " to "
+            << config.host << ":" << config.port << std::endl;
+  proxy.run(g_stop_requested, std::cout);
+  return 0;
+}
@@ -0,0 +1,58 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** CSV log of every packet crossing the proxy
+*/
+
+#include "packet_log.hpp"
+
+namespace jetpack {
+namespace netsim {
+
+namespace {
+
+const char *actionName(Action action) {
+  switch (action) {
+  case Action::Forwarded:
+    return "forwarded";
+  case Action::Dropped:
+    return "dropped";
+  case Action::Reordered:
+    return "reordered";
+  }
+  return "unknown";
+}
+
+} // namespace
+
+bool PacketLog::open(const std::string &path) {
+  out_.open(path);
+  if (!out_)
+    return false;
+  out_ << "connection,direction,type,bytes,received_us,sent_us,action\n";
+  return true;
+}
+
+long long PacketLog::microseconds(Clock::time_point time) const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(time - origin_)
+      .count();
+}
+
+void PacketLog::record(int connection, Direction direction, uint8_t type,
+                       size_t bytes, Clock::time_point received,
+                       Action action, Clock::time_point sent) {
+  if (!out_.is_open())
+    return;
+  out_ << connection << ','
+       << (direction == Direction::Upstream ? "up" : "down") << ','
+       << static_cast<int>(type) << ',' << bytes << ','
+       << microseconds(received) << ',';
+  if (action != Action::Dropped)
+    out_ << microseconds(sent);
+  out_ << ',' << actionName(action) << '\n';
+}
+
+} // namespace netsim
+} // namespace jetpack
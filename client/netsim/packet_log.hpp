@@ -0,0 +1,43 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** CSV log of every packet crossing the proxy
+*/
+
+#ifndef CLIENT_NETSIM_PACKET_LOG_HPP_
+#define CLIENT_NETSIM_PACKET_LOG_HPP_
+
+#include "link_shaper.hpp"
+#include <fstream>
+#include <string>
+
+namespace jetpack {
+namespace netsim {
+
+enum class Direction { Upstream, Downstream };
+
+// One line per packet: connection, direction, type, size, arrival and
+// departure in microseconds since the proxy started, and what the shaper
+// did; dropped packets leave the departure empty
+class PacketLog {
+public:
+  explicit PacketLog(Clock::time_point origin) : origin_(origin) {}
+
+  bool open(const std::string &path);
+  void record(int connection, Direction direction, uint8_t type,
+              size_t bytes, Clock::time_point received, Action action,
+              Clock::time_point sent);
+
+private:
+  Clock::time_point origin_;
+  std::ofstream out_;
+
+  long long microseconds(Clock::time_point time) const;
+};
+
+} // namespace netsim
+} // namespace jetpack
+
+#endif // CLIENT_NETSIM_PACKET_LOG_HPP_
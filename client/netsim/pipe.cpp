@@ -0,0 +1,108 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** One direction of a proxied connection, re-framed on MJP packets
+*/
+
+#include "pipe.hpp"
+#include "../protocol.hpp"
+#include <cerrno>
+#include <unistd.h>
+#include <utility>
+
+namespace jetpack {
+namespace netsim {
+
+Pipe::Pipe(int connection, Direction direction, int from, int to,
+           const LinkShaper &shaper, PacketLog *log)
+    : connection_(connection), direction_(direction), from_(from), to_(to),
+      shaper_(shaper), log_(log) {}
+
+bool Pipe::receive(Clock::time_point now) {
+  uint8_t buffer[4096];
+  ssize_t bytesRead = read(from_, buffer, sizeof(buffer));
+
+  if (bytesRead == 0)
+    return false;
+  if (bytesRead < 0)
+    return errno == EAGAIN || errno == EINTR;
+  input_.insert(input_.end(), buffer, buffer + bytesRead);
+  extractPackets(now);
+  return true;
+}
+
+void Pipe::extractPackets(Clock::time_point now) {
+  size_t offset = 0;
+
+  while (framed_ && input_.size() - offset >= sizeof(protocol::PacketHeader)) {
+    const uint8_t *header = input_.data() + offset;
+    size_t length = (header[2] << 8) | header[3];
+    if (header[0] != protocol::MAGIC_BYTE ||
+        length < sizeof(protocol::PacketHeader)) {
+      // Not MJP: forward the rest of the stream untouched
+      framed_ = false;
+      break;
+    }
+    if (input_.size() - offset < length)
+      break;
+    schedule(std::vector<uint8_t>(header, header + length), now);
+    offset += length;
+  }
+  if (!framed_ && offset < input_.size()) {
+    schedule(std::vector<uint8_t>(input_.begin() + offset, input_.end()), now);
+    offset = input_.size();
+  }
+  input_.erase(input_.begin(), input_.begin() + offset);
+}
+
+void Pipe::schedule(std::vector<uint8_t> bytes, Clock::time_point now) {
+  uint8_t type = framed_ ? bytes[1] : 0;
+  Decision decision = shaper_.schedule(type, bytes.size(), now);
+
+  if (decision.action == Action::Dropped) {
+    stats_.dropped++;
+    if (log_)
+      log_->record(connection_, direction_, type, bytes.size(), now,
+                   decision.action, now);
+    return;
+  }
+  scheduled_.emplace(decision.deliverAt,
+                     Packet{type, now, decision.action, std::move(bytes)});
+}
+
+bool Pipe::flush(Clock::time_point now) {
+  while (!scheduled_.empty() && scheduled_.begin()->first <= now) {
+    Packet &packet = scheduled_.begin()->second;
+    output_.insert(output_.end(), packet.bytes.begin(), packet.bytes.end());
+    stats_.bytes += packet.bytes.size();
+    if (packet.action == Action::Reordered)
+      stats_.reordered++;
+    else
+      stats_.forwarded++;
+    if (log_)
+      log_->record(connection_, direction_, packet.type, packet.bytes.size(),
+                   packet.received, packet.action, now);
+    scheduled_.erase(scheduled_.begin());
+  }
+  if (output_.empty())
+    return true;
+
+  ssize_t written = write(to_, output_.data(), output_.size());
+  if (written < 0)
+    return errno == EAGAIN || errno == EINTR;
+  output_.erase(output_.begin(), output_.begin() + written);
+  return true;
+}
+
+int Pipe::msUntilDue(Clock::time_point now) const {
+  if (scheduled_.empty())
+    return -1;
+  auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+      scheduled_.begin()->first - now);
+  return wait.count() < 0 ? 0 : static_cast<int>(wait.count()) + 1;
+}
+
+} // namespace netsim
+} // namespace jetpack
@@ -0,0 +1,73 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** One direction of a proxied connection, re-framed on MJP packets
+*/
+
+#ifndef CLIENT_NETSIM_PIPE_HPP_
+#define CLIENT_NETSIM_PIPE_HPP_
+
+#include "link_shaper.hpp"
+#include "packet_log.hpp"
+#include <map>
+#include <vector>
+
+namespace jetpack {
+namespace netsim {
+
+struct PipeStats {
+  uint64_t forwarded = 0;
+  uint64_t dropped = 0;
+  uint64_t reordered = 0;
+  uint64_t bytes = 0;
+};
+
+class Pipe {
+public:
+  Pipe(int connection, Direction direction, int from, int to,
+       const LinkShaper &shaper, PacketLog *log);
+
+  // Read what from has and schedule every complete packet; false once the
+  // peer closed or failed
+  bool receive(Clock::time_point now);
+  // Move due packets to the output buffer and write what the socket takes;
+  // false on a write error
+  bool flush(Clock::time_point now);
+
+  bool wantsWrite() const { return !output_.empty(); }
+  bool drained() const { return scheduled_.empty() && output_.empty(); }
+  // Milliseconds until the next scheduled packet is due, -1 when none
+  int msUntilDue(Clock::time_point now) const;
+  const PipeStats &stats() const { return stats_; }
+
+private:
+  struct Packet {
+    uint8_t type;
+    Clock::time_point received;
+    Action action;
+    std::vector<uint8_t> bytes;
+  };
+
+  int connection_;
+  Direction direction_;
+  int from_;
+  int to_;
+  LinkShaper shaper_;
+  PacketLog *log_;
+  PipeStats stats_;
+
+  std::vector<uint8_t> input_;  // Bytes of a packet not complete yet
+  std::vector<uint8_t> output_; // Due bytes the socket has not taken
+  bool framed_ = true;          // Cleared on a bad magic byte
+  std::multimap<Clock::time_point, Packet> scheduled_;
+
+  void schedule(std::vector<uint8_t> bytes, Clock::time_point now);
+  void extractPackets(Clock::time_point now);
+};
+
+} // namespace netsim
+} // namespace jetpack
+
+#endif // CLIENT_NETSIM_PIPE_HPP_
@@ -0,0 +1,199 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** MJP-aware TCP proxy applying a LinkShaper to each direction
+*/
+
+#include "proxy.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace jetpack {
+namespace netsim {
+
+namespace {
+
+// Non-blocking, and without Nagle so the shaper alone decides the timing
+void configureSocket(int fd) {
+  int one = 1;
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+void printStats(std::ostream &out, const char *name, const PipeStats &stats) {
+  out << " " << name << " " << stats.forwarded << " forwarded, "
+      << stats.reordered << " reordered, " << stats.dropped << " dropped ("
+      << stats.bytes << " bytes);";
+}
+
+} // namespace
+
+Proxy::Proxy(const ProxyConfig &config)
+    : config_(config), origin_(Clock::now()), log_(origin_) {}
+
+Proxy::~Proxy() {
+  for (const auto &connection : connections_) {
+    ::close(connection->clientFd);
+    ::close(connection->serverFd);
+  }
+  if (listenFd_ >= 0)
+    ::close(listenFd_);
+}
+
+bool Proxy::listen() {
+  struct sockaddr_in addr;
+  int one = 1;
+
+  if (!config_.logPath.empty() && !log_.open(config_.logPath)) {
+    std::cerr << "Error: Cannot write " << config_.logPath << std::endl;
+    return false;
+  }
+  listenFd_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (listenFd_ < 0)
+    return false;
+  setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(config_.listenPort);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(listenFd_, reinterpret_cast<struct sockaddr *>(&addr),
+           sizeof(addr)) < 0 ||
+      ::listen(listenFd_, 16) < 0) {
+    std::cerr << "Error: Cannot listen on 127.0.0.1:" << config_.listenPort
+              << ": " << strerror(errno) << std::endl;
+    return false;
+  }
+  return true;
+}
+
+int Proxy::connectToServer() const {
+  struct addrinfo hints;
+  struct addrinfo *result = nullptr;
+  std::string port = std::to_string(config_.port);
+  int fd = -1;
+
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(config_.host.c_str(), port.c_str(), &hints, &result) != 0)
+    return -1;
+  fd = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+  if (fd >= 0 && ::connect(fd, result->ai_addr, result->ai_addrlen) < 0) {
+    ::close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(result);
+  return fd;
+}
+
+void Proxy::accept(std::ostream &out) {
+  int clientFd = ::accept(listenFd_, nullptr, nullptr);
+  if (clientFd < 0)
+    return;
+  int serverFd = connectToServer();
+  if (serverFd < 0) {
+    out << "Cannot reach " << config_.host << ":" << config_.port
+        << ", dropping the client" << std::endl;
+    ::close(clientFd);
+    return;
+  }
+  configureSocket(clientFd);
+  configureSocket(serverFd);
+
+  int id = nextId_++;
+  // Each direction gets its own random stream so runs replay exactly
+  LinkShaper up(config_.upstream, config_.seed * 2654435761u + id * 2);
+  LinkShaper down(config_.downstream, config_.seed * 2654435761u + id * 2 + 1);
+  connections_.push_back(std::unique_ptr<Connection>(new Connection{
+      id, clientFd, serverFd,
+      Pipe(id, Direction::Upstream, clientFd, serverFd, up, &log_),
+      Pipe(id, Direction::Downstream, serverFd, clientFd, down, &log_),
+      false}));
+  out << "Connection " << id << " opened" << std::endl;
+}
+
+void Proxy::close(const Connection &connection, std::ostream &out) {
+  out << "Connection " << connection.id << " closed:";
+  printStats(out, "up", connection.upstream.stats());
+  printStats(out, "down", connection.downstream.stats());
+  out << std::endl;
+  ::close(connection.clientFd);
+  ::close(connection.serverFd);
+}
+
+int Proxy::pollTimeout(Clock::time_point now) const {
+  int timeout = 50;
+
+  for (const auto &connection : connections_) {
+    for (const Pipe *pipe : {&connection->upstream, &connection->downstream}) {
+      int due = pipe->msUntilDue(now);
+      if (due >= 0 && due < timeout)
+        timeout = due;
+    }
+  }
+  return timeout;
+}
+
+void Proxy::buildPollSet(std::vector<struct pollfd> *fds) const {
+  fds->assign(1, {listenFd_, POLLIN, 0});
+  for (const auto &connection : connections_) {
+    short read = connection->closing ? 0 : POLLIN;
+    short toClient = connection->downstream.wantsWrite() ? POLLOUT : 0;
+    short toServer = connection->upstream.wantsWrite() ? POLLOUT : 0;
+    fds->push_back(
+        {connection->clientFd, static_cast<short>(read | toClient), 0});
+    fds->push_back(
+        {connection->serverFd, static_cast<short>(read | toServer), 0});
+  }
+}
+
+bool Proxy::service(Connection &connection, const struct pollfd &client,
+                    const struct pollfd &server, Clock::time_point now) {
+  const short readable = POLLIN | POLLHUP | POLLERR;
+
+  if (!connection.closing && (client.revents & readable))
+    connection.closing = !connection.upstream.receive(now);
+  if (!connection.closing && (server.revents & readable))
+    connection.closing = !connection.downstream.receive(now);
+  if (!connection.upstream.flush(now) || !connection.downstream.flush(now))
+    return false;
+  // Packets already in flight still reach the peer that stayed
+  return !connection.closing ||
+         !(connection.upstream.drained() && connection.downstream.drained());
+}
+
+void Proxy::run(const std::atomic<bool> &stopRequested, std::ostream &out) {
+  std::vector<struct pollfd> fds;
+
+  while (!stopRequested) {
+    buildPollSet(&fds);
+    if (poll(fds.data(), fds.size(), pollTimeout(Clock::now())) < 0 &&
+        errno != EINTR)
+      break;
+
+    Clock::time_point now = Clock::now();
+    for (size_t i = 0; i < connections_.size(); i++) {
+      if (!service(*connections_[i], fds[1 + i * 2], fds[2 + i * 2], now)) {
+        close(*connections_[i], out);
+        connections_[i].reset();
+      }
+    }
+    connections_.erase(
+        std::remove(connections_.begin(), connections_.end(), nullptr),
+        connections_.end());
+    if (fds[0].revents & POLLIN)
+      accept(out);
+  }
+}
+
+} // namespace netsim
+} // namespace jetpack
@@ -0,0 +1,74 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** MJP-aware TCP proxy applying a LinkShaper to each direction
+*/
+
+#ifndef CLIENT_NETSIM_PROXY_HPP_
+#define CLIENT_NETSIM_PROXY_HPP_
+
+#include "link_shaper.hpp"
+#include "packet_log.hpp"
+#include "pipe.hpp"
+#include <atomic>
+#include <memory>
+#include <poll.h>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace netsim {
+
+struct ProxyConfig {
+  int listenPort = 0;
+  std::string host; // Server the clients are forwarded to
+  int port = 0;
+  Impairment upstream;   // Client to server
+  Impairment downstream; // Server to client
+  uint32_t seed = 1;
+  std::string logPath; // CSV packet log, none when empty
+};
+
+class Proxy {
+public:
+  explicit Proxy(const ProxyConfig &config);
+  ~Proxy();
+
+  bool listen();
+  // Single-threaded poll loop until stopRequested is set
+  void run(const std::atomic<bool> &stopRequested, std::ostream &out);
+
+private:
+  struct Connection {
+    int id;
+    int clientFd;
+    int serverFd;
+    Pipe upstream;
+    Pipe downstream;
+    bool closing; // One peer left, waiting for the other pipe to drain
+  };
+
+  ProxyConfig config_;
+  Clock::time_point origin_;
+  PacketLog log_;
+  int listenFd_ = -1;
+  int nextId_ = 0;
+  std::vector<std::unique_ptr<Connection>> connections_;
+
+  int connectToServer() const;
+  void accept(std::ostream &out);
+  void close(const Connection &connection, std::ostream &out);
+  int pollTimeout(Clock::time_point now) const;
+  void buildPollSet(std::vector<struct pollfd> *fds) const;
+  // Read, shape and write one connection; false once it should be closed
+  bool service(Connection &connection, const struct pollfd &client,
+               const struct pollfd &server, Clock::time_point now);
+};
+
+} // namespace netsim
+} // namespace jetpack
+
+#endif // CLIENT_NETSIM_PROXY_HPP_
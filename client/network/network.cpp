@@ -7,7 +7,11 @@
 */
 
 #include "network.hpp"
+#include "../debug/alloc_counter.hpp"
 #include "../debug/debug.hpp"
+#include "../debug/latency_probe.hpp"
+#include "../debug/log.hpp"
+#include "../debug/trace.hpp"
 #include <arpa/inet.h>
 #include <chrono>
 #include <cstring>
@@ -16,6 +20,7 @@
 #include <netdb.h>
 #include <sstream>
 #include <thread>
+#include <utility>
 
 namespace jetpack {
 namespace network {
@@ -24,7 +29,7 @@ Network::Network(const std::string &host, int port, bool debugMode,
                  GameState *gameState)
     : host_(host), port_(port), debugMode_(debugMode), socket_(-1),
       running_(false), gameState_(gameState),
-      protocolHandlers_(gameState, debugMode) {
+      protocolHandlers_(gameState) {
 
   pfd_.fd = -1;
   pfd_.events = POLLIN;
@@ -34,7 +39,7 @@ Network::Network(const std::string &host, int port, bool debugMode,
 Network::~Network() {
   stop();
   if (socket_ >= 0) {
-    debug::logToFile("Network", "Closing socket", debugMode_);
+    JETPACK_LOG_DEBUG("Network", "Closing socket");
     close(socket_);
   }
 }
@@ -45,39 +50,39 @@ bool Network::connect() {
 
   socket_ = socket(AF_INET, SOCK_STREAM, 0);
   if (socket_ < 0) {
-    std::cerr << "Error creating socket" << std::endl;
+    JETPACK_LOG_ERROR("Network", "Cannot create socket: " << strerror(errno));
     return false;
   }
 
-  debug::logToFile("Network", "Socket created", debugMode_);
+  JETPACK_LOG_DEBUG("Network", "Socket created");
 
   server = gethostbyname(host_.c_str());
   if (server == nullptr) {
-    std::cerr << "Error: No such host" << std::endl;
+    JETPACK_LOG_ERROR("Network", "No such host: " << host_);
     close(socket_);
     socket_ = -1;
     return false;
   }
 
-  debug::logToFile("Network", "Hostname resolved", debugMode_);
+  JETPACK_LOG_DEBUG("Network", "Hostname resolved");
 
   memset(&server_addr, 0, sizeof(server_addr));
   server_addr.sin_family = AF_INET;
   memcpy(&server_addr.sin_addr.s_addr, server->h_addr, server->h_length);
   server_addr.sin_port = htons(port_);
 
-  debug::logToFile("Network",
-                   "Connecting to " + host_ + ":" + std::to_string(port_),
-                   debugMode_);
+  JETPACK_LOG_DEBUG("Network", "Connecting to " << host_ << ":" << port_);
   if (::connect(socket_, (struct sockaddr *)&server_addr, sizeof(server_addr)) <
       0) {
-    std::cerr << "Error connecting to server" << std::endl;
+    JETPACK_LOG_ERROR("Network",
+                      "Cannot connect to " << host_ << ":" << port_ << ": "
+                                           << strerror(errno));
     close(socket_);
     socket_ = -1;
     return false;
   }
 
-  debug::logToFile("Network", "Connected successfully", debugMode_);
+  JETPACK_LOG_DEBUG("Network", "Connected successfully");
 
   pfd_.fd = socket_;
   pfd_.events = POLLIN;
@@ -92,21 +97,19 @@ bool Network::connect() {
   payload.insert(payload.end(), name, name + nameLen);
 
   if (!sendPacket(protocol::CLIENT_CONNECT, payload)) {
-    std::cerr << "Failed to send connect packet" << std::endl;
+    JETPACK_LOG_ERROR("Network", "Failed to send CLIENT_CONNECT");
     close(socket_);
     socket_ = -1;
     return false;
   }
 
-  debug::logToFile("Network",
-                   "CLIENT_CONNECT sent with name: " + std::string(name),
-                   debugMode_);
+  JETPACK_LOG_DEBUG("Network", "CLIENT_CONNECT sent with name: " << name);
   return true;
 }
 
 void Network::disconnect() {
   if (socket_ >= 0) {
-    debug::logToFile("Network", "Sending CLIENT_DISCONNECT", debugMode_);
+    JETPACK_LOG_DEBUG("Network", "Sending CLIENT_DISCONNECT");
     sendPacket(protocol::CLIENT_DISCONNECT, {});
     close(socket_);
     socket_ = -1;
@@ -126,18 +129,19 @@ void Network::run() {
     std::vector<uint8_t> payload;
     auto lastInputTime = std::chrono::steady_clock::now();
 
-    debug::logToFile("Network", "Network thread started", debugMode_);
+    debug::setTraceThreadName("network");
+    JETPACK_LOG_DEBUG("Network", "Network thread started");
 
     while (running_) {
       int pollResult = poll(&pfd_, 1, 50);
 
       if (pollResult < 0) {
-        debug::logToFile("Network",
-                         "Error in poll(): " + std::string(strerror(errno)),
-                         debugMode_);
+        JETPACK_LOG_ERROR("Network", "poll() failed: " << strerror(errno));
         break;
       } else if (pollResult > 0) {
         if (pfd_.revents & POLLIN) {
+          debug::TraceSpan span("receivePacket", "network");
+          debug::AllocScope packetAllocs;
           if (receivePacket(&header, &payload)) {
             protocol::PacketType packetType =
                 static_cast<protocol::PacketType>(header.type);
@@ -160,17 +164,23 @@ void Network::run() {
             case protocol::DEBUG_INFO:
               protocolHandlers_.handleDebugInfo(payload);
               break;
+            case protocol::COIN_EVENT:
+              protocolHandlers_.handleCoinEvent(payload);
+              break;
             default:
-              debug::print("Network",
-                           "Received unknown packet type: " +
-                               std::to_string(header.type),
-                           debugMode_);
+              JETPACK_LOG_INFO("Network", "Received unknown packet type: "
+                                              << static_cast<int>(header.type));
+            }
+            if (debug::allocTrackingEnabled()) {
+              debug::recordPacketAllocs(packetAllocs.elapsed());
+            }
+            if (packetObserver_) {
+              packetObserver_(header, payload);
             }
           }
         }
         if (pfd_.revents & (POLLHUP | POLLERR)) {
-          debug::logToFile("Network", "Socket error or disconnect detected",
-                           debugMode_);
+          JETPACK_LOG_DEBUG("Network", "Socket error or disconnect detected");
           break;
         }
       }
@@ -181,6 +191,7 @@ void Network::run() {
                                                                 lastInputTime)
                   .count() > 50) { // 20Hz input rate
 
+        debug::TraceSpan span("sendPlayerInput", "network");
         sendPlayerInput();
         lastInputTime = now;
       }
@@ -188,15 +199,14 @@ void Network::run() {
       checkConnectionHealth();
     }
 
-    debug::logToFile("Network", "Network thread exiting", debugMode_);
+    JETPACK_LOG_DEBUG("Network", "Network thread exiting");
   });
 }
 
 void Network::stop() {
   running_ = false;
   if (networkThread_.joinable()) {
-    debug::logToFile("Network", "Waiting for network thread to exit",
-                     debugMode_);
+    JETPACK_LOG_DEBUG("Network", "Waiting for network thread to exit");
     networkThread_.join();
   }
 }
@@ -212,34 +222,22 @@ bool Network::sendPacket(protocol::PacketType type,
   header.length = htons(payload.size() + sizeof(header));
 
   if (write(socket_, &header, sizeof(header)) != sizeof(header)) {
-    debug::logToFile("Network",
-                     "Failed to send packet header: " +
-                         std::string(strerror(errno)),
-                     debugMode_);
+    JETPACK_LOG_DEBUG("Network",
+                      "Failed to send packet header: " << strerror(errno));
     return false;
   }
 
   if (!payload.empty()) {
     if (write(socket_, payload.data(), payload.size()) !=
         static_cast<ssize_t>(payload.size())) {
-      debug::logToFile("Network",
-                       "Failed to send packet payload: " +
-                           std::string(strerror(errno)),
-                       debugMode_);
+      JETPACK_LOG_DEBUG("Network",
+                        "Failed to send packet payload: " << strerror(errno));
       return false;
     }
   }
 
-  if (debugMode_) {
-    std::stringstream ss;
-    ss << "Sent packet: Type=0x" << std::hex << static_cast<int>(type)
-       << std::dec << " (" << packetTypeToString(type)
-       << "), Length=" << (payload.size() + sizeof(header)) << " bytes";
-
-    if (!payload.empty() && payload.size() <= 64) {
-      ss << "\nPayload: " << debug::formatHexDump(payload);
-    }
-    debug::logToFile("Network", ss.str(), true);
+  if (debug::isEnabled(debug::Level::Trace)) {
+    debug::logPacket("Network", true, &header, sizeof(header), payload);
   }
 
   return true;
@@ -253,27 +251,23 @@ bool Network::receivePacket(protocol::PacketHeader *header,
   ssize_t bytesRead = read(socket_, header, sizeof(*header));
   if (bytesRead != sizeof(*header)) {
     if (bytesRead == 0) {
-      debug::logToFile("Network", "Server closed connection", debugMode_);
+      JETPACK_LOG_DEBUG("Network", "Server closed connection");
     } else if (bytesRead < 0) {
-      debug::logToFile("Network",
-                       "Error reading header: " + std::string(strerror(errno)),
-                       debugMode_);
+      JETPACK_LOG_ERROR("Network",
+                        "Cannot read packet header: " << strerror(errno));
     }
     return false;
   }
 
   if (header->magic != protocol::MAGIC_BYTE) {
-    debug::logToFile("Network",
-                     "Invalid magic byte: 0x" + toHexString(header->magic),
-                     debugMode_);
+    JETPACK_LOG_DEBUG("Network",
+                      "Invalid magic byte: 0x" << toHexString(header->magic));
     return false;
   }
 
   uint16_t packetLength = ntohs(header->length);
   if (packetLength < sizeof(*header)) {
-    debug::logToFile("Network",
-                     "Invalid packet length: " + std::to_string(packetLength),
-                     debugMode_);
+    JETPACK_LOG_DEBUG("Network", "Invalid packet length: " << packetLength);
     return false;
   }
 
@@ -284,52 +278,46 @@ bool Network::receivePacket(protocol::PacketHeader *header,
 
     bytesRead = read(socket_, payload->data(), payloadLength);
     if (bytesRead != static_cast<ssize_t>(payloadLength)) {
-      debug::logToFile("Network",
-                       "Failed to receive full payload: expected " +
-                           std::to_string(payloadLength) + " bytes, got " +
-                           std::to_string(bytesRead),
-                       debugMode_);
+      JETPACK_LOG_ERROR("Network", "Truncated payload: expected "
+                                       << payloadLength << " bytes, got "
+                                       << bytesRead);
       return false;
     }
   } else {
     payload->clear();
   }
 
-  if (debugMode_) {
-    std::stringstream ss;
-    ss << "Received packet: Type=0x" << std::hex
-       << static_cast<int>(header->type) << std::dec << " ("
-       << packetTypeToString(static_cast<protocol::PacketType>(header->type))
-       << "), Length=" << packetLength << " bytes";
-
-    if (!payload->empty() && payload->size() <= 64) {
-      ss << "\nPayload: " << debug::formatHexDump(*payload);
-    }
-    debug::print("Network", ss.str(), true);
+  if (debug::isEnabled(debug::Level::Trace)) {
+    debug::logPacket("Network", false, header, sizeof(*header), *payload);
   }
 
   return true;
 }
 
 void Network::sendPlayerInput() {
-  std::vector<uint8_t> payload;
   uint8_t playerId = gameState_->getAssignedId();
   uint8_t jetpackState = gameState_->isJetpackActive() ? protocol::JETPACK_ON
                                                        : protocol::JETPACK_OFF;
 
-  payload.push_back(playerId);
-  payload.push_back(jetpackState);
+  inputPayload_.resize(2);
+  inputPayload_[0] = playerId;
+  inputPayload_[1] = jetpackState;
 
-  sendPacket(protocol::CLIENT_INPUT, payload);
+  // Stamped before the write: on loopback the server kernel gets the
+  // packet before send() returns
+  if (jetpackState != lastJetpackState_ && debug::isProbing()) {
+    debug::probeEvent("input_sent", playerId,
+                      jetpackState == protocol::JETPACK_ON ? 1 : 0, 0);
+  }
+  sendPacket(protocol::CLIENT_INPUT, inputPayload_);
 
   // Log when jetpack state changes
-  static uint8_t lastJetpackState = 0xFF;
-  if (jetpackState != lastJetpackState) {
-    std::stringstream ss;
-    ss << "Input changed: Jetpack="
-       << (jetpackState == protocol::JETPACK_ON ? "ON" : "OFF");
-    debug::logToFile("Network", ss.str(), debugMode_);
-    lastJetpackState = jetpackState;
+  if (jetpackState != lastJetpackState_) {
+    JETPACK_LOG_DEBUG("Network",
+                      "Input changed: Jetpack="
+                          << (jetpackState == protocol::JETPACK_ON ? "ON"
+                                                                   : "OFF"));
+    lastJetpackState_ = jetpackState;
   }
 }
 
@@ -353,29 +341,8 @@ bool Network::sendDebugMessage(const std::string &message) {
 
 void Network::checkConnectionHealth() {}
 
-std::string Network::packetTypeToString(protocol::PacketType type) {
-  switch (type) {
-  case protocol::CLIENT_CONNECT:
-    return "CLIENT_CONNECT";
-  case protocol::SERVER_WELCOME:
-    return "SERVER_WELCOME";
-  case protocol::MAP_CHUNK:
-    return "MAP_CHUNK";
-  case protocol::GAME_START:
-    return "GAME_START";
-  case protocol::CLIENT_INPUT:
-    return "CLIENT_INPUT";
-  case protocol::GAME_STATE:
-    return "GAME_STATE";
-  case protocol::GAME_END:
-    return "GAME_END";
-  case protocol::CLIENT_DISCONNECT:
-    return "CLIENT_DISCONNECT";
-  case protocol::DEBUG_INFO:
-    return "DEBUG_INFO";
-  default:
-    return "UNKNOWN";
-  }
+void Network::setPacketObserver(PacketObserver observer) {
+  packetObserver_ = std::move(observer);
 }
 
 std::string Network::toHexString(uint8_t byte) {
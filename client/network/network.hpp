@@ -14,6 +14,7 @@
 #include "protocol_handlers.hpp"
 #include <arpa/inet.h>
 #include <atomic>
+#include <functional>
 #include <netinet/in.h>
 #include <poll.h>
 #include <string>
@@ -27,6 +28,11 @@ namespace network {
 
 class Network {
 public:
+  // Called on the network thread for every packet, after it was handled
+  using PacketObserver =
+      std::function<void(const protocol::PacketHeader &header,
+                         const std::vector<uint8_t> &payload)>;
+
   Network(const std::string &host, int port, bool debugMode,
           GameState *gameState);
   ~Network();
@@ -48,6 +54,9 @@ public:
   bool sendDebugMessage(const std::string &message);
   void checkConnectionHealth();
 
+  // Must be set before run()
+  void setPacketObserver(PacketObserver observer);
+
 private:
   // Network configuration
   std::string host_;
@@ -66,11 +75,16 @@ private:
   // Protocol handlers
   ProtocolHandlers protocolHandlers_;
 
+  // Outgoing CLIENT_INPUT payload, reused every input tick
+  std::vector<uint8_t> inputPayload_;
+  uint8_t lastJetpackState_ = 0xFF; // Last state logged
+
+  PacketObserver packetObserver_;
+
   // Network thread function
   void networkLoop();
 
   // Helper methods for debugging
-  std::string packetTypeToString(protocol::PacketType type);
   std::string toHexString(uint8_t byte);
 };
 
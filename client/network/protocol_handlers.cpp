@@ -8,19 +8,20 @@
 
 #include "protocol_handlers.hpp"
 #include "../debug/debug.hpp"
-#include <sstream>
+#include "../debug/latency_probe.hpp"
+#include "../debug/log.hpp"
 
 namespace jetpack {
 namespace network {
 
-ProtocolHandlers::ProtocolHandlers(GameState *gameState, bool debugMode)
-    : gameState_(gameState), debugMode_(debugMode), expectedChunkCount(0),
-      receivedChunkCount(0), mapComplete(false) {}
+ProtocolHandlers::ProtocolHandlers(GameState *gameState)
+    : gameState_(gameState), expectedChunkCount(0), receivedChunkCount(0),
+      mapComplete(false) {}
 
 void ProtocolHandlers::handleServerWelcome(
     const std::vector<uint8_t> &payload) {
   if (payload.size() < 2) {
-    debugPrint("SERVER_WELCOME: Invalid payload size");
+    JETPACK_LOG_INFO("Protocol", "SERVER_WELCOME: Invalid payload size");
     return;
   }
 
@@ -28,37 +29,39 @@ void ProtocolHandlers::handleServerWelcome(
   uint8_t assignedId = payload[1];
 
   if (acceptCode == 1) {
-    debugLogToFile("SERVER_WELCOME: Connection accepted, Assigned ID=" +
-                   std::to_string(assignedId));
+    JETPACK_LOG_DEBUG("Protocol",
+                      "SERVER_WELCOME: Connection accepted, Assigned ID="
+                          << static_cast<int>(assignedId));
 
     if (payload.size() > 2) {
-      std::stringstream ss;
-      ss << "Additional data (" << (payload.size() - 2) << " bytes): ";
-      ss << debug::formatHexDump(
-          std::vector<uint8_t>(payload.begin() + 2, payload.end()));
-      debugLogToFile(ss.str());
+      JETPACK_LOG_DEBUG("Protocol",
+                        "Additional data ("
+                            << (payload.size() - 2) << " bytes): "
+                            << debug::formatHexDump(std::vector<uint8_t>(
+                                   payload.begin() + 2, payload.end())));
     }
 
     gameState_->setConnected(true);
     gameState_->setAssignedId(assignedId);
   } else {
-    debugPrint("SERVER_WELCOME: Connection rejected");
+    JETPACK_LOG_INFO("Protocol", "SERVER_WELCOME: Connection rejected");
     gameState_->setConnected(false);
   }
 }
 
 void ProtocolHandlers::handleMapChunk(const std::vector<uint8_t> &payload) {
   if (payload.size() < 4) {
-    debugPrint("MAP_CHUNK: Invalid payload size");
+    JETPACK_LOG_INFO("Protocol", "MAP_CHUNK: Invalid payload size");
     return;
   }
 
   uint16_t chunkIndex = (payload[0] << 8) | payload[1];
   uint16_t chunkCount = (payload[2] << 8) | payload[3];
 
-  debugLogToFile("MAP_CHUNK: Index=" + std::to_string(chunkIndex) +
-                 ", Count=" + std::to_string(chunkCount) +
-                 ", Size=" + std::to_string(payload.size() - 4) + " bytes");
+  JETPACK_LOG_DEBUG("Protocol", "MAP_CHUNK: Index="
+                                    << chunkIndex << ", Count=" << chunkCount
+                                    << ", Size=" << (payload.size() - 4)
+                                    << " bytes");
 
   if (chunkIndex == 0) {
     mapChunks.clear();
@@ -69,8 +72,9 @@ void ProtocolHandlers::handleMapChunk(const std::vector<uint8_t> &payload) {
   }
 
   if (chunkIndex >= mapChunks.size()) {
-    debugPrint("MAP_CHUNK: Invalid chunk index: " + std::to_string(chunkIndex) +
-               ", expected max " + std::to_string(mapChunks.size() - 1));
+    JETPACK_LOG_INFO("Protocol", "MAP_CHUNK: Invalid chunk index: "
+                                     << chunkIndex << ", expected max "
+                                     << (mapChunks.size() - 1));
     return;
   }
 
@@ -80,15 +84,17 @@ void ProtocolHandlers::handleMapChunk(const std::vector<uint8_t> &payload) {
   receivedChunkCount++;
 
   if (receivedChunkCount == expectedChunkCount) {
-    debugLogToFile("MAP_CHUNK: All " + std::to_string(expectedChunkCount) +
-                   " chunks received, processing complete map");
+    JETPACK_LOG_DEBUG("Protocol", "MAP_CHUNK: All "
+                                      << expectedChunkCount
+                                      << " chunks received, processing "
+                                         "complete map");
     processCompleteMap();
   }
 }
 
 void ProtocolHandlers::handleGameStart(const std::vector<uint8_t> &payload) {
   if (payload.size() < 5) {
-    debugPrint("GAME_START: Invalid payload size");
+    JETPACK_LOG_INFO("Protocol", "GAME_START: Invalid payload size");
     return;
   }
 
@@ -96,16 +102,17 @@ void ProtocolHandlers::handleGameStart(const std::vector<uint8_t> &payload) {
   uint16_t startX = (payload[1] << 8) | payload[2];
   uint16_t startY = (payload[3] << 8) | payload[4];
 
-  debugLogToFile("GAME_START: Player count=" + std::to_string(playerCount) +
-                 ", Start position=(" + std::to_string(startX) + "," +
-                 std::to_string(startY) + ")");
+  JETPACK_LOG_DEBUG("Protocol", "GAME_START: Player count="
+                                    << static_cast<int>(playerCount)
+                                    << ", Start position=(" << startX << ","
+                                    << startY << ")");
 
   gameState_->setGameRunning(true);
 }
 
 void ProtocolHandlers::handleGameState(const std::vector<uint8_t> &payload) {
   if (payload.size() < 5) {
-    debugPrint("GAME_STATE: Invalid payload size");
+    JETPACK_LOG_INFO("Protocol", "GAME_STATE: Invalid payload size");
     return;
   }
 
@@ -113,28 +120,30 @@ void ProtocolHandlers::handleGameState(const std::vector<uint8_t> &payload) {
       (payload[0] << 24) | (payload[1] << 16) | (payload[2] << 8) | payload[3];
   uint8_t numPlayers = payload[4];
 
-  debugLogToFile("GAME_STATE: Tick=" + std::to_string(tick) +
-                 ", Players=" + std::to_string(numPlayers));
+  JETPACK_LOG_TRACE("Protocol", "GAME_STATE: Tick="
+                                    << tick << ", Players="
+                                    << static_cast<int>(numPlayers));
 
   gameState_->setCurrentTick(tick);
 
   // Each player data is 9 bytes (ID, X, Y, Score, Alive, CollectedCoin)
   const size_t PLAYER_DATA_SIZE = 9;
   if (payload.size() < 5 + (numPlayers * PLAYER_DATA_SIZE)) {
-    debugPrint("GAME_STATE: Not enough data for " + std::to_string(numPlayers) +
-               " players (need " +
-               std::to_string(5 + numPlayers * PLAYER_DATA_SIZE) +
-               " bytes, got " + std::to_string(payload.size()) + ")");
+    JETPACK_LOG_INFO("Protocol",
+                     "GAME_STATE: Not enough data for "
+                         << static_cast<int>(numPlayers) << " players (need "
+                         << (5 + numPlayers * PLAYER_DATA_SIZE)
+                         << " bytes, got " << payload.size() << ")");
     return;
   }
 
-  std::vector<protocol::PlayerState> playerStates;
+  playerStates_.clear();
   for (int i = 0; i < numPlayers; i++) {
     int offset = 5 + (i * PLAYER_DATA_SIZE);
     protocol::PlayerState state;
 
-    debugLogToFile("Processing player " + std::to_string(i) +
-                   " data at offset " + std::to_string(offset));
+    JETPACK_LOG_TRACE("Protocol", "Processing player "
+                                      << i << " data at offset " << offset);
     state.id = payload[offset];
     state.posX = (payload[offset + 1] << 8) | payload[offset + 2];
     state.posY = (payload[offset + 3] << 8) | payload[offset + 4];
@@ -142,52 +151,79 @@ void ProtocolHandlers::handleGameState(const std::vector<uint8_t> &payload) {
     state.alive = payload[offset + 7];
     state.collectedCoin = payload[offset + 8];
 
-    playerStates.push_back(state);
+    playerStates_.push_back(state);
 
-    debugLogToFile("Player " + std::to_string(state.id) + ": Position=(" +
-                   std::to_string(state.posX) + "," +
-                   std::to_string(state.posY) +
-                   "), Score=" + std::to_string(state.score) +
-                   ", Alive=" + std::to_string(state.alive) +
-                   ", CollectedCoin=" + std::to_string(state.collectedCoin));
+    JETPACK_LOG_TRACE("Protocol",
+                      "Player " << static_cast<int>(state.id)
+                                << ": Position=(" << state.posX << ","
+                                << state.posY << "), Score=" << state.score
+                                << ", Alive=" << static_cast<int>(state.alive)
+                                << ", CollectedCoin="
+                                << static_cast<int>(state.collectedCoin));
   }
 
-  gameState_->setPlayerStates(playerStates);
+  gameState_->setPlayerStates(playerStates_);
+  if (debug::isProbing()) {
+    probeLocalMotion(tick);
+  }
+}
+
+// Reports the packets where the local player starts rising (1), falling (0)
+// or stops (2): where a jetpack change first shows in the game state
+void ProtocolHandlers::probeLocalMotion(uint32_t tick) {
+  uint8_t localId = gameState_->getAssignedId();
+
+  for (const auto &state : playerStates_) {
+    if (state.id != localId)
+      continue;
+    int y = state.posY;
+    int motion = y < probeY_ ? 1 : (y > probeY_ ? 0 : 2);
+    if (probeY_ >= 0 && motion != probeMotion_) {
+      debug::probeEvent("state_rx", localId, motion, tick);
+      probeMotion_ = motion;
+    }
+    probeY_ = y;
+    return;
+  }
 }
 
 void ProtocolHandlers::handleGameEnd(const std::vector<uint8_t> &payload) {
   if (payload.size() < 2) {
-    debugPrint("GAME_END: Invalid payload size");
+    JETPACK_LOG_INFO("Protocol", "GAME_END: Invalid payload size");
     return;
   }
 
   uint8_t reasonCode = payload[0];
   uint8_t winnerId = payload[1];
 
-  std::string reasonStr;
-  switch (reasonCode) {
-  case protocol::MAP_COMPLETE:
-    reasonStr = "Map completed";
-    break;
-  case protocol::PLAYER_DIED:
-    reasonStr = "Player died";
-    break;
-  case protocol::PLAYER_DISCONNECT:
-    reasonStr = "Player disconnected";
-    break;
-  default:
-    reasonStr = "Unknown (" + std::to_string(reasonCode) + ")";
-  }
+  if (debug::isEnabled(debug::Level::Info)) {
+    std::string reasonStr;
+    switch (reasonCode) {
+    case protocol::MAP_COMPLETE:
+      reasonStr = "Map completed";
+      break;
+    case protocol::PLAYER_DIED:
+      reasonStr = "Player died";
+      break;
+    case protocol::PLAYER_DISCONNECT:
+      reasonStr = "Player disconnected";
+      break;
+    default:
+      reasonStr = "Unknown (" + std::to_string(reasonCode) + ")";
+    }
 
-  std::string winnerStr = (winnerId == protocol::NO_WINNER)
-                              ? "Draw"
-                              : "Player " + std::to_string(winnerId);
+    std::string winnerStr = (winnerId == protocol::NO_WINNER)
+                                ? "Draw"
+                                : "Player " + std::to_string(winnerId);
 
-  debugPrint("GAME_END: Reason=" + reasonStr + ", Winner=" + winnerStr);
+    JETPACK_LOG_INFO("Protocol",
+                     "GAME_END: Reason=" << reasonStr << ", Winner="
+                                         << winnerStr);
+  }
 
   if (payload.size() > 2) {
-    debugPrint("GAME_END: Score data present (" +
-               std::to_string(payload.size() - 2) + " bytes)");
+    JETPACK_LOG_INFO("Protocol", "GAME_END: Score data present ("
+                                     << (payload.size() - 2) << " bytes)");
   }
 
   gameState_->setGameRunning(false);
@@ -196,7 +232,7 @@ void ProtocolHandlers::handleGameEnd(const std::vector<uint8_t> &payload) {
 
 void ProtocolHandlers::handleDebugInfo(const std::vector<uint8_t> &payload) {
   if (payload.size() < 2) {
-    debugPrint("DEBUG_INFO: Invalid payload size");
+    JETPACK_LOG_INFO("Protocol", "DEBUG_INFO: Invalid payload size");
     return;
   }
 
@@ -204,26 +240,65 @@ void ProtocolHandlers::handleDebugInfo(const std::vector<uint8_t> &payload) {
 
   size_t requiredSize = static_cast<size_t>(2) + static_cast<size_t>(msgLen);
   if (payload.size() < requiredSize) {
-    debugPrint("DEBUG_INFO: Not enough data");
+    JETPACK_LOG_INFO("Protocol", "DEBUG_INFO: Not enough data");
+    return;
+  }
+
+  JETPACK_LOG_INFO("Protocol",
+                   "SERVER DEBUG: " << std::string(payload.begin() + 2,
+                                                   payload.begin() + 2 +
+                                                       msgLen));
+}
+
+void ProtocolHandlers::handleCoinEvent(const std::vector<uint8_t> &payload) {
+  if (payload.size() < 6) {
+    JETPACK_LOG_INFO("Protocol", "COIN_EVENT: Invalid payload size");
+    return;
+  }
+
+  uint32_t tick =
+      (payload[0] << 24) | (payload[1] << 16) | (payload[2] << 8) | payload[3];
+  uint16_t count = (payload[4] << 8) | payload[5];
+
+  // Each event is 5 bytes (CoinId, CollectorId)
+  const size_t EVENT_DATA_SIZE = 5;
+  if (payload.size() < 6 + count * EVENT_DATA_SIZE) {
+    JETPACK_LOG_INFO("Protocol", "COIN_EVENT: Not enough data for "
+                                     << count << " events");
     return;
   }
 
-  std::string debugMsg(payload.begin() + 2, payload.begin() + 2 + msgLen);
-  debugPrint("SERVER DEBUG: " + debugMsg);
+  coinEvents_.clear();
+  for (uint16_t i = 0; i < count; i++) {
+    size_t offset = 6 + i * EVENT_DATA_SIZE;
+    protocol::CoinEvent event;
+
+    event.coinId = (payload[offset] << 24) | (payload[offset + 1] << 16) |
+                   (payload[offset + 2] << 8) | payload[offset + 3];
+    event.collectorId = payload[offset + 4];
+    coinEvents_.push_back(event);
+
+    JETPACK_LOG_TRACE("Protocol", "COIN_EVENT: Tick="
+                                      << tick << ", Coin=" << event.coinId
+                                      << ", Collector="
+                                      << static_cast<int>(event.collectorId));
+  }
+
+  gameState_->applyCoinEvents(coinEvents_);
 }
 
 void ProtocolHandlers::processCompleteMap() {
   uint16_t numColumns = static_cast<uint16_t>(mapChunks.size());
 
   if (numColumns == 0) {
-    debugPrint("processCompleteMap: No map chunks received");
+    JETPACK_LOG_INFO("Protocol", "processCompleteMap: No map chunks received");
     return;
   }
 
   uint16_t mapHeight = static_cast<uint16_t>(mapChunks[0].size());
 
-  debugLogToFile("Processing map with dimensions: " +
-                 std::to_string(numColumns) + "x" + std::to_string(mapHeight));
+  JETPACK_LOG_DEBUG("Protocol", "Processing map with dimensions: "
+                                    << numColumns << "x" << mapHeight);
 
   gameState_->setMapDimensions(numColumns, mapHeight);
 
@@ -233,9 +308,10 @@ void ProtocolHandlers::processCompleteMap() {
     const auto &columnData = mapChunks[col];
 
     if (columnData.size() != mapHeight) {
-      debugPrint("WARNING: Column " + std::to_string(col) +
-                 " has unexpected size: " + std::to_string(columnData.size()) +
-                 " (expected " + std::to_string(mapHeight) + ")");
+      JETPACK_LOG_WARN("Protocol", "WARNING: Column "
+                                       << col << " has unexpected size: "
+                                       << columnData.size() << " (expected "
+                                       << mapHeight << ")");
       continue;
     }
 
@@ -268,15 +344,7 @@ void ProtocolHandlers::processCompleteMap() {
   gameState_->setMapData(finalMap);
 
   mapComplete = true;
-  debugLogToFile("Map processing completed successfully");
-}
-
-void ProtocolHandlers::debugPrint(const std::string &message) {
-  debug::print("Protocol", message, debugMode_);
-}
-
-void ProtocolHandlers::debugLogToFile(const std::string &message) {
-  debug::logToFile("Protocol", message, debugMode_);
+  JETPACK_LOG_DEBUG("Protocol", "Map processing completed successfully");
 }
 
 } // namespace network
@@ -18,7 +18,7 @@ namespace network {
 
 class ProtocolHandlers {
 public:
-  ProtocolHandlers(GameState *gameState, bool debugMode);
+  explicit ProtocolHandlers(GameState *gameState);
   ~ProtocolHandlers() = default;
 
   // Protocol message handlers
@@ -28,10 +28,15 @@ public:
   void handleGameState(const std::vector<uint8_t> &payload);
   void handleGameEnd(const std::vector<uint8_t> &payload);
   void handleDebugInfo(const std::vector<uint8_t> &payload);
+  void handleCoinEvent(const std::vector<uint8_t> &payload);
 
 private:
   GameState *gameState_;
-  bool debugMode_;
+
+  // Decode scratch reused across GAME_STATE packets
+  std::vector<protocol::PlayerState> playerStates_;
+  // Decode scratch reused across COIN_EVENT packets
+  std::vector<protocol::CoinEvent> coinEvents_;
 
   // Temporary storage for map reconstruction
   std::vector<std::vector<uint8_t>> mapChunks;
@@ -39,10 +44,13 @@ private:
   uint16_t receivedChunkCount;
   bool mapComplete;
 
+  // Last height and motion of the local player, for the latency probe
+  int probeY_ = -1;
+  int probeMotion_ = -1;
+
   // Helper methods
-  void debugPrint(const std::string &message);
-  void debugLogToFile(const std::string &message);
   void processCompleteMap();
+  void probeLocalMotion(uint32_t tick);
 };
 
 } // namespace network
@@ -27,7 +27,8 @@ enum PacketType : uint8_t {
   GAME_STATE = 0x06,        // Server -> Client: Game state update
   GAME_END = 0x07,          // Server -> Client: Game over
   CLIENT_DISCONNECT = 0x08, // Both ways: Graceful disconnect
-  DEBUG_INFO = 0x09         // Both ways: Debug text messages
+  DEBUG_INFO = 0x09,        // Both ways: Debug text messages
+  COIN_EVENT = 0x0A         // Server -> Client: Coins collected this tick
 };
 
 // Game end reason codes
@@ -60,6 +61,12 @@ struct PlayerState {
   uint8_t collectedCoin;
 };
 
+// One entry of a COIN_EVENT batch
+struct CoinEvent {
+  uint32_t coinId; // Row-major tile index (row * map width + column)
+  uint8_t collectorId;
+};
+
 // Map element types
 enum MapElement : uint8_t {
   EMPTY = 0x00,
@@ -0,0 +1,149 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Feeds a replay into the game state in place of the network thread
+*/
+
+#include "replay_player.hpp"
+#include "../debug/log.hpp"
+#include "../debug/trace.hpp"
+#include "../network/protocol_handlers.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace jetpack {
+namespace replay {
+
+ReplayPlayer::ReplayPlayer(ReplayReader *reader, GameState *gameState)
+    : reader_(reader), gameState_(gameState), running_(false),
+      paused_(false), speed_(1.0), seekTarget_(-1), currentTick_(0) {}
+
+ReplayPlayer::~ReplayPlayer() { stop(); }
+
+// The map goes through the same decoder as MAP_CHUNK packets, one column
+// per chunk
+void ReplayPlayer::load() {
+  const replay_file_header_t &header = reader_->header();
+  const std::vector<uint8_t> &map = reader_->map();
+  network::ProtocolHandlers handlers(gameState_);
+  std::vector<uint8_t> chunk(4 + header.map_rows);
+
+  for (uint16_t col = 0; col < header.map_cols; col++) {
+    chunk[0] = col >> 8;
+    chunk[1] = col & 0xFF;
+    chunk[2] = header.map_cols >> 8;
+    chunk[3] = header.map_cols & 0xFF;
+    for (uint16_t row = 0; row < header.map_rows; row++)
+      chunk[4 + row] = map[static_cast<size_t>(row) * header.map_cols + col];
+    handlers.handleMapChunk(chunk);
+  }
+  gameState_->setConnected(true);
+  gameState_->setAssignedId(0);
+  gameState_->setGameRunning(true);
+  rewind();
+  step();
+}
+
+bool ReplayPlayer::step() {
+  if (!reader_->next(&frame_))
+    return false;
+  publish(frame_);
+  return true;
+}
+
+void ReplayPlayer::rewind() { reader_->seek(reader_->firstTick()); }
+
+void ReplayPlayer::run() {
+  load();
+  running_ = true;
+  thread_ = std::thread([this]() {
+    debug::setTraceThreadName("replay");
+    loop();
+  });
+}
+
+void ReplayPlayer::stop() {
+  running_ = false;
+  if (thread_.joinable())
+    thread_.join();
+}
+
+void ReplayPlayer::setSpeed(double speed) {
+  speed_ = std::min(std::max(speed, MIN_SPEED), MAX_SPEED);
+}
+
+void ReplayPlayer::seekTo(uint32_t tick) {
+  tick = std::min(std::max(tick, reader_->firstTick()), reader_->lastTick());
+  seekTarget_ = tick;
+}
+
+void ReplayPlayer::seekBySeconds(double seconds) {
+  double ticks = seconds * 1e6 / std::max(reader_->header().tick_us, 1u);
+  int64_t target = static_cast<int64_t>(currentTick_) +
+                   static_cast<int64_t>(ticks);
+
+  seekTo(static_cast<uint32_t>(std::max<int64_t>(target, 0)));
+}
+
+void ReplayPlayer::loop() {
+  using Clock = std::chrono::steady_clock;
+  auto nextFrame = Clock::now();
+
+  while (running_) {
+    int64_t target = seekTarget_.exchange(-1);
+    if (target >= 0) {
+      applySeek(static_cast<uint32_t>(target));
+      nextFrame = Clock::now();
+    }
+
+    auto now = Clock::now();
+    if (paused_ || now < nextFrame) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      if (paused_)
+        nextFrame = now;
+      continue;
+    }
+    if (!step()) {
+      // End of the recording: stay on the last frame, seeking still works
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      continue;
+    }
+    nextFrame += std::chrono::microseconds(static_cast<int64_t>(
+        reader_->header().tick_us / speed_.load()));
+  }
+}
+
+// Decode from the key frame before target, publishing only the last frame
+void ReplayPlayer::applySeek(uint32_t target) {
+  debug::TraceSpan span("replaySeek", "replay");
+  bool decoded = false;
+
+  reader_->seek(target);
+  while (reader_->next(&frame_)) {
+    if (frame_.key)
+      gameState_->clearCoins();
+    gameState_->applyCoinEvents(frame_.coins);
+    decoded = true;
+    if (frame_.tick >= target)
+      break;
+  }
+  if (decoded)
+    publish(frame_);
+  JETPACK_LOG_DEBUG("Replay", "Seeked to tick " << currentTick_);
+}
+
+void ReplayPlayer::publish(const ReplayFrame &frame) {
+  if (frame.key)
+    gameState_->clearCoins();
+  gameState_->applyCoinEvents(frame.coins);
+  gameState_->setPlayerStates(frame.players);
+  gameState_->setCurrentTick(frame.tick);
+  gameState_->setGameRunning(!frame.ended);
+  gameState_->setGameEnded(frame.ended, frame.winnerId);
+  currentTick_ = frame.tick;
+}
+
+} // namespace replay
+} // namespace jetpack
@@ -0,0 +1,67 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Feeds a replay into the game state in place of the network thread
+*/
+
+#ifndef CLIENT_REPLAY_REPLAY_PLAYER_HPP_
+#define CLIENT_REPLAY_REPLAY_PLAYER_HPP_
+
+#include "../gamestate.hpp"
+#include "replay_reader.hpp"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace jetpack {
+namespace replay {
+
+class ReplayPlayer {
+public:
+  static constexpr double MIN_SPEED = 1.0 / 16;
+  static constexpr double MAX_SPEED = 64.0;
+
+  ReplayPlayer(ReplayReader *reader, GameState *gameState);
+  ~ReplayPlayer();
+
+  // Publish the map and the first frame
+  void load();
+  // Publish the next frame; false once the recording is over
+  bool step();
+  // Back to the first frame, published by the next step()
+  void rewind();
+
+  // load(), then play on a background thread
+  void run();
+  void stop();
+
+  // Playback controls, callable from any thread
+  void setSpeed(double speed);
+  double getSpeed() const { return speed_; }
+  void togglePause() { paused_ = !paused_; }
+  void seekTo(uint32_t tick);
+  void seekBySeconds(double seconds);
+  uint32_t getCurrentTick() const { return currentTick_; }
+
+private:
+  ReplayReader *reader_;
+  GameState *gameState_;
+  std::thread thread_;
+  std::atomic<bool> running_;
+  std::atomic<bool> paused_;
+  std::atomic<double> speed_;
+  std::atomic<int64_t> seekTarget_; // -1 when no seek is pending
+  std::atomic<uint32_t> currentTick_;
+  ReplayFrame frame_;
+
+  void loop();
+  void applySeek(uint32_t target);
+  void publish(const ReplayFrame &frame);
+};
+
+} // namespace replay
+} // namespace jetpack
+
+#endif // CLIENT_REPLAY_REPLAY_PLAYER_HPP_
@@ -0,0 +1,188 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Decoder of match replay files recorded by the server (-r)
+*/
+
+#include "replay_reader.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace jetpack {
+namespace replay {
+
+bool ReplayReader::open(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+
+  if (!file)
+    return fail("Cannot open " + path);
+  data_.assign(std::istreambuf_iterator<char>(file),
+               std::istreambuf_iterator<char>());
+  index_.clear();
+  lastTick_ = 0;
+  if (!readHeader())
+    return false;
+  if (readIndex()) {
+    scanFrames(index_.back().offset, false);
+  } else {
+    // Recording cut short: no index, rebuild it from the frames
+    index_.clear();
+    scanFrames(framesBegin_, true);
+  }
+  if (index_.empty())
+    return fail(path + " holds no frame");
+  seek(firstTick());
+  return true;
+}
+
+uint32_t ReplayReader::firstTick() const {
+  return index_.empty() ? 0 : index_.front().tick;
+}
+
+uint32_t ReplayReader::lastTick() const { return lastTick_; }
+
+void ReplayReader::seek(uint32_t tick) {
+  auto it = std::upper_bound(
+      index_.begin(), index_.end(), tick,
+      [](uint32_t value, const replay_index_entry_t &entry) {
+        return value < entry.tick;
+      });
+
+  if (it != index_.begin())
+    --it;
+  cursor_ = it == index_.end() ? framesEnd_ : it->offset;
+  hasColumns_ = false;
+}
+
+bool ReplayReader::next(ReplayFrame *frame) {
+  replay_frame_header_t header;
+
+  if (cursor_ < framesBegin_ || cursor_ + sizeof(header) > framesEnd_)
+    return false;
+  std::memcpy(&header, data_.data() + cursor_, sizeof(header));
+  if (header.len > framesEnd_ - cursor_ - sizeof(header))
+    return false;
+  if (header.kind == REPLAY_FRAME_KEY) {
+    columns_ = replay_columns_t();
+    hasColumns_ = true;
+  } else if (!hasColumns_) {
+    return false;
+  }
+  frame->tick = header.tick;
+  frame->key = header.kind == REPLAY_FRAME_KEY;
+  frame->ended = header.status == REPLAY_ENDED;
+  frame->winnerId = header.winner;
+  if (!decodePayload(data_.data() + cursor_ + sizeof(header), header.len,
+                     frame)) {
+    hasColumns_ = false;
+    return false;
+  }
+  cursor_ += sizeof(header) + header.len;
+  return true;
+}
+
+bool ReplayReader::fail(const std::string &message) {
+  error_ = message;
+  return false;
+}
+
+bool ReplayReader::readHeader() {
+  if (data_.size() < sizeof(header_))
+    return fail("Replay file too short");
+  std::memcpy(&header_, data_.data(), sizeof(header_));
+  if (header_.magic != REPLAY_MAGIC || header_.version != REPLAY_VERSION)
+    return fail("Not a replay file (or an unsupported version)");
+  if (header_.player_count > REPLAY_MAX_PLAYERS)
+    return fail("Replay player count out of range");
+
+  size_t mapSize = static_cast<size_t>(header_.map_rows) * header_.map_cols;
+  if (data_.size() - sizeof(header_) < mapSize)
+    return fail("Replay map truncated");
+  map_.assign(data_.begin() + sizeof(header_),
+              data_.begin() + sizeof(header_) + mapSize);
+  if (replay_map_hash(map_.data(), map_.size()) != header_.map_hash)
+    return fail("Replay map hash mismatch");
+  framesBegin_ = sizeof(header_) + mapSize;
+  framesEnd_ = data_.size();
+  return true;
+}
+
+bool ReplayReader::readIndex() {
+  replay_index_header_t index;
+  uint64_t offset = header_.index_offset;
+
+  if (offset < framesBegin_ || data_.size() < sizeof(index) ||
+      offset > data_.size() - sizeof(index))
+    return false;
+  std::memcpy(&index, data_.data() + offset, sizeof(index));
+
+  size_t available = (data_.size() - offset - sizeof(index)) /
+                     sizeof(replay_index_entry_t);
+  if (index.magic != REPLAY_INDEX_MAGIC || index.count == 0 ||
+      index.count > available)
+    return false;
+  index_.resize(index.count);
+  std::memcpy(index_.data(), data_.data() + offset + sizeof(index),
+              index.count * sizeof(replay_index_entry_t));
+  framesEnd_ = offset;
+  return true;
+}
+
+void ReplayReader::scanFrames(size_t offset, bool collectKeys) {
+  replay_frame_header_t frame;
+
+  while (offset >= framesBegin_ && offset + sizeof(frame) <= framesEnd_) {
+    std::memcpy(&frame, data_.data() + offset, sizeof(frame));
+    if (frame.len > framesEnd_ - offset - sizeof(frame))
+      break;
+    if (collectKeys && frame.kind == REPLAY_FRAME_KEY)
+      index_.push_back({frame.tick, 0, offset});
+    lastTick_ = frame.tick;
+    offset += sizeof(frame) + frame.len;
+  }
+  if (collectKeys)
+    framesEnd_ = offset; // Drop a frame torn by the cut
+}
+
+bool ReplayReader::decodePayload(const uint8_t *payload, uint32_t len,
+                                 ReplayFrame *frame) {
+  int count = header_.player_count;
+  size_t used = replay_decode_players(payload, len, &columns_, count);
+  uint32_t coinCount;
+
+  if ((used == 0 && count > 0) || len - used < sizeof(coinCount))
+    return false;
+  std::memcpy(&coinCount, payload + used, sizeof(coinCount));
+  used += sizeof(coinCount);
+  if (coinCount > (len - used) / sizeof(replay_coin_t))
+    return false;
+
+  frame->players.resize(count);
+  for (int i = 0; i < count; i++) {
+    protocol::PlayerState &player = frame->players[i];
+    uint32_t flags = columns_.values[REPLAY_FLAGS][i];
+
+    player.id = static_cast<uint8_t>(i);
+    player.posX = static_cast<uint16_t>(columns_.values[REPLAY_X][i]);
+    player.posY = static_cast<uint16_t>(columns_.values[REPLAY_Y][i]);
+    player.score = static_cast<uint16_t>(columns_.values[REPLAY_SCORE][i]);
+    player.alive = (flags & REPLAY_PLAYER_ALIVE) != 0;
+    player.collectedCoin = (flags & REPLAY_PLAYER_COIN) != 0;
+  }
+  frame->coins.resize(coinCount);
+  for (uint32_t i = 0; i < coinCount; i++) {
+    replay_coin_t coin;
+
+    std::memcpy(&coin, payload + used + i * sizeof(coin), sizeof(coin));
+    frame->coins[i].coinId = coin.coin_id;
+    frame->coins[i].collectorId = coin.collector;
+  }
+  return true;
+}
+
+} // namespace replay
+} // namespace jetpack
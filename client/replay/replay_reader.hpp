@@ -0,0 +1,72 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Decoder of match replay files recorded by the server (-r)
+*/
+
+#ifndef CLIENT_REPLAY_REPLAY_READER_HPP_
+#define CLIENT_REPLAY_REPLAY_READER_HPP_
+
+#include "../protocol.hpp"
+#include "replay.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace replay {
+
+struct ReplayFrame {
+  uint32_t tick = 0;
+  bool key = false;
+  bool ended = false;
+  uint8_t winnerId = protocol::NO_WINNER;
+  std::vector<protocol::PlayerState> players;
+  // Coins collected on this tick, or every coin so far on a key frame
+  std::vector<protocol::CoinEvent> coins;
+};
+
+// Loads the whole file; replays are a few bytes per player and tick
+class ReplayReader {
+public:
+  bool open(const std::string &path);
+  const std::string &error() const { return error_; }
+
+  const replay_file_header_t &header() const { return header_; }
+  // Map file characters, row-major, header().map_cols per row
+  const std::vector<uint8_t> &map() const { return map_; }
+  uint32_t firstTick() const;
+  uint32_t lastTick() const;
+
+  // Move to the last key frame at or before tick; next() decodes from there
+  void seek(uint32_t tick);
+  // Decode the next frame; false at the end or on a truncated frame
+  bool next(ReplayFrame *frame);
+
+private:
+  std::vector<uint8_t> data_;
+  std::string error_;
+  replay_file_header_t header_ = {};
+  std::vector<uint8_t> map_;
+  std::vector<replay_index_entry_t> index_;
+  size_t framesBegin_ = 0;
+  size_t framesEnd_ = 0;
+  size_t cursor_ = 0;
+  uint32_t lastTick_ = 0;
+  replay_columns_t columns_ = {};
+  bool hasColumns_ = false;
+
+  bool fail(const std::string &message);
+  bool readHeader();
+  bool readIndex();
+  void scanFrames(size_t offset, bool collectKeys);
+  bool decodePayload(const uint8_t *payload, uint32_t len, ReplayFrame *frame);
+};
+
+} // namespace replay
+} // namespace jetpack
+
+#endif // CLIENT_REPLAY_REPLAY_READER_HPP_
@@ -0,0 +1,109 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Soak test entrypoint
+*/
+
+#include "../debug/log.hpp"
+#include "soak_runner.hpp"
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <string>
+
+namespace {
+
+std::atomic<bool> g_stop_requested(false);
+
+void signal_handler(int) { g_stop_requested = true; }
+
+void print_usage(const char *program_name) {
+  std::cout << "Usage: " << program_name
+            << " -p <port> -M <metrics port> [-h <host>] [-n <players>]"
+               " [-g <matches>] [-t <minutes>] [-w <matches>] [-o <csv>]"
+            << std::endl;
+  std::cout << "Plays matches back to back against jetpack_server -c 0 -M "
+               "<metrics port>, then flags"
+            << std::endl;
+  std::cout << "live allocations, resident memory and open fds that grow "
+               "from match to match"
+            << std::endl;
+  std::cout << "  -n <players>  Bots per match, the server -n (default 2)"
+            << std::endl;
+  std::cout << "  -g <matches>  Stop after this many matches (default: no "
+               "limit)"
+            << std::endl;
+  std::cout << "  -t <minutes>  Stop after this long (default 60)"
+            << std::endl;
+  std::cout << "  -w <matches>  Warm-up matches left out of the trends "
+               "(default 3)"
+            << std::endl;
+  std::cout << "  -o <csv>      Write one line per match" << std::endl;
+  std::cout << "Exit status 2 when a series grows" << std::endl;
+}
+
+bool parse_int(const char *text, int min, int *value) {
+  try {
+    *value = std::stoi(text);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return *value >= min;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  jetpack::soak::SoakConfig config;
+  bool valid = true;
+
+  for (int i = 1; i < argc && valid; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+
+    if (arg == "-h" && hasValue) {
+      config.host = argv[++i];
+    } else if (arg == "-p" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.port) && config.port <= 65535;
+    } else if (arg == "-M" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.metricsPort) &&
+              config.metricsPort <= 65535;
+    } else if (arg == "-n" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.players);
+    } else if (arg == "-g" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.matches);
+    } else if (arg == "-t" && hasValue) {
+      valid = parse_int(argv[++i], 1, &config.durationMinutes);
+    } else if (arg == "-w" && hasValue) {
+      valid = parse_int(argv[++i], 0, &config.warmupMatches);
+    } else if (arg == "-o" && hasValue) {
+      config.csvPath = argv[++i];
+    } else {
+      valid = false;
+    }
+  }
+  if (!valid || config.port <= 0 || config.metricsPort <= 0) {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  jetpack::debug::setLogLevel(jetpack::debug::Level::Off);
+  std::signal(SIGINT, signal_handler);
+  std::signal(SIGTERM, signal_handler);
+  std::signal(SIGPIPE, SIG_IGN);
+
+  jetpack::soak::SoakRunner runner(config);
+  bool completed = runner.run(g_stop_requested, std::cout);
+  if (!completed)
+    std::cerr << "Error: " << runner.error() << std::endl;
+  runner.printReport(std::cout);
+  if (!completed)
+    return 1;
+  for (const auto &trend : runner.trends()) {
+    if (trend.growing)
+      return 2;
+  }
+  return 0;
+}
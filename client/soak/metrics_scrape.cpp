@@ -0,0 +1,82 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Prometheus scrape implementation
+*/
+
+#include "metrics_scrape.hpp"
+#include <arpa/inet.h>
+#include <cstring>
+#include <netdb.h>
+#include <sstream>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace jetpack {
+namespace soak {
+
+namespace {
+
+int connectTo(const std::string &host, int port) {
+  struct addrinfo hints;
+  struct addrinfo *result = nullptr;
+  int fd = -1;
+
+  std::memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints,
+                  &result) != 0)
+    return -1;
+  fd = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+  if (fd >= 0 && ::connect(fd, result->ai_addr, result->ai_addrlen) < 0) {
+    close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(result);
+  return fd;
+}
+
+} // namespace
+
+bool scrapeMetrics(const std::string &host, int port, MetricValues *values) {
+  static const char request[] = "GET /metrics HTTP/1.0\r\n\r\n";
+  std::string response;
+  char buffer[4096];
+  ssize_t received;
+  int fd = connectTo(host, port);
+
+  if (fd < 0)
+    return false;
+  if (send(fd, request, sizeof(request) - 1, MSG_NOSIGNAL) < 0) {
+    close(fd);
+    return false;
+  }
+  while ((received = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+    response.append(buffer, static_cast<size_t>(received));
+  close(fd);
+
+  size_t body = response.find("\r\n\r\n");
+  if (body == std::string::npos)
+    return false;
+  std::istringstream lines(response.substr(body + 4));
+  std::string line;
+  values->clear();
+  while (std::getline(lines, line)) {
+    size_t space = line.find(' ');
+    if (line.empty() || line[0] == '#' || space == std::string::npos ||
+        line.find('{') < space)
+      continue;
+    try {
+      (*values)[line.substr(0, space)] = std::stod(line.substr(space + 1));
+    } catch (const std::exception &) {
+      continue;
+    }
+  }
+  return true;
+}
+
+} // namespace soak
+} // namespace jetpack
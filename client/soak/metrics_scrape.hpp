@@ -0,0 +1,30 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Minimal reader of the server Prometheus endpoint (jetpack_server -M)
+*/
+
+#ifndef CLIENT_SOAK_METRICS_SCRAPE_HPP_
+#define CLIENT_SOAK_METRICS_SCRAPE_HPP_
+
+#include <map>
+#include <string>
+
+namespace jetpack {
+namespace soak {
+
+// Unlabelled samples only, by metric name
+using MetricValues = std::map<std::string, double>;
+
+/**
+ * GET /metrics from host:port and parse the unlabelled samples; false
+ * when the endpoint cannot be reached
+ */
+bool scrapeMetrics(const std::string &host, int port, MetricValues *values);
+
+} // namespace soak
+} // namespace jetpack
+
+#endif // CLIENT_SOAK_METRICS_SCRAPE_HPP_
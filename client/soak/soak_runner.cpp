@@ -0,0 +1,184 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Soak runner implementation
+*/
+
+#include "soak_runner.hpp"
+#include "../loadgen/load_generator.hpp"
+#include "metrics_scrape.hpp"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+
+namespace jetpack {
+namespace soak {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Time left to the server to close the connections of a finished match
+constexpr auto IDLE_TIMEOUT = std::chrono::seconds(5);
+constexpr auto IDLE_POLL = std::chrono::milliseconds(50);
+
+// Growth flagged above one leaked allocation every two matches, one page
+// of resident memory per match or one descriptor every twenty matches
+constexpr double ALLOCATION_LIMIT = 0.5;
+constexpr double RESIDENT_LIMIT = 4096.0;
+constexpr double FD_LIMIT = 0.05;
+constexpr size_t MIN_TREND_SAMPLES = 5;
+
+double metric(const MetricValues &values, const char *name) {
+  auto it = values.find(name);
+  return it == values.end() ? 0.0 : it->second;
+}
+
+} // namespace
+
+SoakRunner::SoakRunner(const SoakConfig &config) : config_(config) {}
+
+bool SoakRunner::run(const std::atomic<bool> &stopRequested,
+                     std::ostream &progress) {
+  auto start = Clock::now();
+  auto deadline = start + std::chrono::minutes(config_.durationMinutes);
+
+  for (int match = 0; !stopRequested && Clock::now() < deadline &&
+                      (config_.matches == 0 || match < config_.matches);
+       match++) {
+    loadgen::LoadConfig load;
+    load.host = config_.host;
+    load.port = config_.port;
+    load.clients = config_.players;
+    load.durationSeconds = config_.matchTimeoutSeconds;
+    load.seed = config_.seed + static_cast<uint32_t>(match * config_.players);
+
+    loadgen::LoadGenerator generator(load);
+    if (!generator.run(stopRequested)) {
+      error_ = "No bot could connect to " + config_.host + ":" +
+               std::to_string(config_.port);
+      break;
+    }
+    if (stopRequested)
+      break;
+    double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    if (!sample(match, seconds))
+      break;
+
+    const SoakSample &last = samples_.back();
+    char line[160];
+    std::snprintf(line, sizeof(line),
+                  "match %d: %.0f s, %.0f live allocations, %.2f MiB "
+                  "resident, %.0f fds\n",
+                  match + 1, last.seconds, last.liveAllocations,
+                  last.residentBytes / (1024.0 * 1024.0), last.openFds);
+    progress << line << std::flush;
+  }
+  writeCsv();
+  return error_.empty();
+}
+
+// Taken in the lobby, after the server closed every connection, so each
+// sample sees the same live state
+bool SoakRunner::sample(int match, double seconds) {
+  auto deadline = Clock::now() + IDLE_TIMEOUT;
+  MetricValues values;
+
+  while (true) {
+    if (!scrapeMetrics(config_.host, config_.metricsPort, &values)) {
+      error_ = "Cannot scrape metrics on port " +
+               std::to_string(config_.metricsPort);
+      return false;
+    }
+    if (metric(values, "jetpack_match_running") == 0 &&
+        metric(values, "jetpack_connected_clients") == 0)
+      break;
+    if (Clock::now() >= deadline) {
+      error_ = "Server still in match " + std::to_string(match + 1) +
+               " after its bots stopped";
+      return false;
+    }
+    std::this_thread::sleep_for(IDLE_POLL);
+  }
+
+  SoakSample sample;
+  sample.match = match + 1;
+  sample.seconds = seconds;
+  sample.liveAllocations = metric(values, "jetpack_allocations_total") -
+                           metric(values, "jetpack_frees_total");
+  sample.allocatedBytes = metric(values, "jetpack_allocated_bytes_total");
+  sample.residentBytes = metric(values, "process_resident_memory_bytes");
+  sample.openFds = metric(values, "process_open_fds");
+  samples_.push_back(sample);
+  return true;
+}
+
+std::vector<Trend> SoakRunner::trends() const {
+  std::vector<double> allocations;
+  std::vector<double> resident;
+  std::vector<double> fds;
+
+  for (const auto &sample : samples_) {
+    if (sample.match <= config_.warmupMatches)
+      continue;
+    allocations.push_back(sample.liveAllocations);
+    resident.push_back(sample.residentBytes);
+    fds.push_back(sample.openFds);
+  }
+  if (allocations.size() < MIN_TREND_SAMPLES)
+    return {};
+  return {fitTrend("live allocations", allocations, ALLOCATION_LIMIT),
+          fitTrend("resident bytes", resident, RESIDENT_LIMIT),
+          fitTrend("open fds", fds, FD_LIMIT)};
+}
+
+void SoakRunner::printReport(std::ostream &out) const {
+  std::vector<Trend> results = trends();
+  char line[160];
+
+  std::snprintf(line, sizeof(line), "%zu matches played, %.1f min\n",
+                samples_.size(),
+                samples_.empty() ? 0.0 : samples_.back().seconds / 60.0);
+  out << line;
+  if (results.empty()) {
+    std::snprintf(line, sizeof(line),
+                  "Too few matches for trends: need %zu after the %d "
+                  "warm-up ones\n",
+                  MIN_TREND_SAMPLES, config_.warmupMatches);
+    out << line;
+    return;
+  }
+  std::snprintf(line, sizeof(line), "%-18s %14s %14s %12s %10s  %s\n",
+                "series", "first", "last", "per match", "limit", "verdict");
+  out << line;
+  for (const auto &trend : results) {
+    std::snprintf(line, sizeof(line),
+                  "%-18s %14.0f %14.0f %12.3f %10.3f  %s\n",
+                  trend.name.c_str(), trend.first, trend.last,
+                  trend.slopePerMatch, trend.limitPerMatch,
+                  trend.growing ? "GROWING" : "flat");
+    out << line;
+  }
+}
+
+void SoakRunner::writeCsv() const {
+  if (config_.csvPath.empty())
+    return;
+  std::ofstream out(config_.csvPath);
+  out << "match,seconds,live_allocations,allocated_bytes,resident_bytes,"
+         "open_fds\n";
+  out << std::fixed << std::setprecision(0);
+  for (const auto &sample : samples_) {
+    out << sample.match << "," << sample.seconds << ","
+        << sample.liveAllocations << "," << sample.allocatedBytes << ","
+        << sample.residentBytes << "," << sample.openFds << "\n";
+  }
+}
+
+} // namespace soak
+} // namespace jetpack
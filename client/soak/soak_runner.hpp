@@ -0,0 +1,71 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Back-to-back matches against a server, sampling its resources
+*/
+
+#ifndef CLIENT_SOAK_SOAK_RUNNER_HPP_
+#define CLIENT_SOAK_SOAK_RUNNER_HPP_
+
+#include "trend.hpp"
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace soak {
+
+struct SoakConfig {
+  std::string host = "127.0.0.1";
+  int port = 0;
+  int metricsPort = 0;
+  int players = 2; // Must match jetpack_server -n
+  int matches = 0; // 0 plays until durationMinutes elapse
+  int durationMinutes = 60;
+  int matchTimeoutSeconds = 600;
+  int warmupMatches = 3; // Left out of the trends
+  std::string csvPath;   // One line per match when set
+  uint32_t seed = 1;
+};
+
+// Server state between two matches, once every connection was closed
+struct SoakSample {
+  int match = 0;
+  double seconds = 0.0; // Since the soak started
+  double liveAllocations = 0.0;
+  double allocatedBytes = 0.0; // Cumulated
+  double residentBytes = 0.0;
+  double openFds = 0.0;
+};
+
+class SoakRunner {
+public:
+  explicit SoakRunner(const SoakConfig &config);
+
+  // Play matches until the limit, the duration or stopRequested; false
+  // with error() set when the server stops answering
+  bool run(const std::atomic<bool> &stopRequested, std::ostream &progress);
+
+  // Trends after the warm-up matches; empty when too few were played
+  std::vector<Trend> trends() const;
+  void printReport(std::ostream &out) const;
+
+  const std::string &error() const { return error_; }
+
+private:
+  SoakConfig config_;
+  std::vector<SoakSample> samples_;
+  std::string error_;
+
+  bool sample(int match, double seconds);
+  void writeCsv() const;
+};
+
+} // namespace soak
+} // namespace jetpack
+
+#endif // CLIENT_SOAK_SOAK_RUNNER_HPP_
@@ -0,0 +1,44 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Growth detection implementation
+*/
+
+#include "trend.hpp"
+
+namespace jetpack {
+namespace soak {
+
+Trend fitTrend(const std::string &name, const std::vector<double> &values,
+               double limitPerMatch) {
+  Trend trend;
+  double count = static_cast<double>(values.size());
+  double sumX = 0.0;
+  double sumY = 0.0;
+  double sumXY = 0.0;
+  double sumXX = 0.0;
+
+  trend.name = name;
+  trend.limitPerMatch = limitPerMatch;
+  if (values.size() < 2)
+    return trend;
+  for (size_t i = 0; i < values.size(); i++) {
+    double x = static_cast<double>(i);
+    sumX += x;
+    sumY += values[i];
+    sumXY += x * values[i];
+    sumXX += x * x;
+  }
+  trend.first = values.front();
+  trend.last = values.back();
+  trend.slopePerMatch =
+      (count * sumXY - sumX * sumY) / (count * sumXX - sumX * sumX);
+  trend.growing =
+      trend.slopePerMatch > limitPerMatch && trend.last > trend.first;
+  return trend;
+}
+
+} // namespace soak
+} // namespace jetpack
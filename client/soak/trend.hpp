@@ -0,0 +1,37 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Growth detection over per-match resource samples
+*/
+
+#ifndef CLIENT_SOAK_TREND_HPP_
+#define CLIENT_SOAK_TREND_HPP_
+
+#include <string>
+#include <vector>
+
+namespace jetpack {
+namespace soak {
+
+struct Trend {
+  std::string name;
+  double first = 0.0;
+  double last = 0.0;
+  double slopePerMatch = 0.0; // Least-squares fit over the samples
+  double limitPerMatch = 0.0;
+  bool growing = false;
+};
+
+/**
+ * Fit a line through one value per match; the series grows when the
+ * slope is above limitPerMatch and the last value above the first
+ */
+Trend fitTrend(const std::string &name, const std::vector<double> &values,
+               double limitPerMatch);
+
+} // namespace soak
+} // namespace jetpack
+
+#endif // CLIENT_SOAK_TREND_HPP_
@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Binary logger lifecycle
+*/
+
+#include "includes/binlog_internal.h"
+#include <stdlib.h>
+#include <time.h>
+
+binlog_state_t *binlog_state(void)
+{
+    static binlog_state_t state;
+
+    return &state;
+}
+
+uint64_t binlog_clock_ns(int clock_id)
+{
+    struct timespec ts;
+
+    clock_gettime(clock_id, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+bool binlog_open(const char *path)
+{
+    binlog_state_t *state = binlog_state();
+    binlog_file_header_t header = {BINLOG_MAGIC, BINLOG_VERSION, 0,
+        binlog_clock_ns(CLOCK_REALTIME), binlog_clock_ns(CLOCK_MONOTONIC)};
+
+    if (atomic_load(&state->open))
+        return true;
+    state->file = fopen(path, "wb");
+    if (!state->file)
+        return false;
+    setvbuf(state->file, NULL, _IOFBF, 1 << 16);
+    fwrite(&header, sizeof(header), 1, state->file);
+    atomic_store(&state->cached_ns, header.mono_start_ns);
+    atomic_store(&state->dropped, 0);
+    if (!binlog_start_writer(state)) {
+        fclose(state->file);
+        state->file = NULL;
+        return false;
+    }
+    atomic_store(&state->open, true);
+    return true;
+}
+
+void binlog_close(void)
+{
+    binlog_state_t *state = binlog_state();
+    uint64_t dropped;
+
+    if (!atomic_exchange(&state->open, false))
+        return;
+    binlog_stop_writer(state);
+    fclose(state->file);
+    state->file = NULL;
+    dropped = atomic_exchange(&state->dropped_total, 0);
+    if (dropped > 0)
+        fprintf(stderr, "Debug log: %lu records dropped\n",
+            (unsigned long)dropped);
+}
+
+bool binlog_enabled(void)
+{
+    return atomic_load_explicit(&binlog_state()->open, memory_order_relaxed);
+}
@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Record producers of the binary logger
+*/
+
+#include "includes/binlog_internal.h"
+#include <string.h>
+
+static void clamp_parts(size_t sizes[3])
+{
+    size_t room = BINLOG_MAX_PAYLOAD - sizes[0];
+
+    if (sizes[1] > room)
+        sizes[1] = room;
+    room -= sizes[1];
+    if (sizes[2] > room)
+        sizes[2] = room;
+}
+
+static void push_record(binlog_record_t *record, const void *parts[3],
+    size_t sizes[3])
+{
+    binlog_state_t *state = binlog_state();
+    binlog_ring_t *ring = binlog_thread_ring();
+
+    clamp_parts(sizes);
+    record->ts_ns = binlog_now();
+    record->len = (uint16_t)(sizes[0] + sizes[1] + sizes[2]);
+    record->thread = ring ? ring->id : 0xFF;
+    if (!ring || !binlog_ring_push(ring, record, parts, sizes)) {
+        atomic_fetch_add_explicit(&state->dropped, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&state->dropped_total, 1,
+            memory_order_relaxed);
+    }
+}
+
+uint64_t binlog_now(void)
+{
+    return atomic_load_explicit(&binlog_state()->cached_ns,
+        memory_order_relaxed);
+}
+
+void binlog_text(const char *component, const char *msg, size_t len)
+{
+    binlog_record_t record = {0};
+    const void *parts[3] = {component, msg, NULL};
+    size_t sizes[3] = {strlen(component) + 1, len, 0};
+
+    if (!binlog_enabled())
+        return;
+    record.kind = BINLOG_KIND_TEXT;
+    record.orig_len = len > 0xFFFF ? 0xFFFF : (uint16_t)len;
+    push_record(&record, parts, sizes);
+}
+
+void binlog_packet(const binlog_packet_t *packet)
+{
+    binlog_record_t record = {0};
+    const void *parts[3] = {packet->component, packet->header,
+        packet->payload};
+    size_t sizes[3] = {strlen(packet->component) + 1, packet->header_len,
+        packet->payload_len};
+
+    if (!binlog_enabled())
+        return;
+    record.kind = BINLOG_KIND_PACKET;
+    record.direction = packet->direction;
+    record.orig_len = (uint16_t)(packet->header_len + packet->payload_len);
+    push_record(&record, parts, sizes);
+}
@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Per-thread single-producer rings of the binary logger
+*/
+
+#include "includes/binlog_internal.h"
+#include <string.h>
+
+static void ring_copy_in(binlog_ring_t *ring, size_t pos, const void *src,
+    size_t size)
+{
+    size_t offset = pos & (BINLOG_RING_SIZE - 1);
+    size_t first = BINLOG_RING_SIZE - offset;
+
+    if (first > size)
+        first = size;
+    memcpy(ring->data + offset, src, first);
+    memcpy(ring->data, (const uint8_t *)src + first, size - first);
+}
+
+bool binlog_ring_push(binlog_ring_t *ring, const binlog_record_t *record,
+    const void *parts[3], const size_t sizes[3])
+{
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    size_t pos = head + sizeof(*record);
+
+    if (BINLOG_RING_SIZE - (head - tail) <
+        sizeof(*record) + sizes[0] + sizes[1] + sizes[2])
+        return false;
+    ring_copy_in(ring, head, record, sizeof(*record));
+    for (int i = 0; i < 3; i++) {
+        if (sizes[i] > 0)
+            ring_copy_in(ring, pos, parts[i], sizes[i]);
+        pos += sizes[i];
+    }
+    atomic_store_explicit(&ring->head, pos, memory_order_release);
+    return true;
+}
+
+size_t binlog_ring_drain(binlog_ring_t *ring, FILE *file)
+{
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t size = head - tail;
+    size_t offset = tail & (BINLOG_RING_SIZE - 1);
+    size_t first = BINLOG_RING_SIZE - offset;
+
+    if (size == 0)
+        return 0;
+    if (first > size)
+        first = size;
+    fwrite(ring->data + offset, 1, first, file);
+    fwrite(ring->data, 1, size - first, file);
+    atomic_store_explicit(&ring->tail, head, memory_order_release);
+    return size;
+}
@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Ring ownership: one ring per live thread, recycled once the thread exits
+*/
+
+#include "includes/binlog_internal.h"
+#include <stdlib.h>
+
+static _Thread_local binlog_ring_t *thread_ring = NULL;
+static _Thread_local bool thread_ringless = false;
+static pthread_key_t ring_key;
+static pthread_once_t ring_key_once = PTHREAD_ONCE_INIT;
+
+// Thread exit: what is left in the ring is still drained by the writer
+static void release_ring(void *ring)
+{
+    atomic_store_explicit(&((binlog_ring_t *)ring)->in_use, false,
+        memory_order_release);
+}
+
+static void create_ring_key(void)
+{
+    pthread_key_create(&ring_key, release_ring);
+}
+
+// Ring of an exited thread once the writer emptied it; it keeps its id
+static binlog_ring_t *reuse_ring(binlog_state_t *state)
+{
+    int count = atomic_load(&state->ring_count);
+    binlog_ring_t *ring;
+    bool free_ring;
+
+    for (int i = 0; i < count; i++) {
+        ring = atomic_load_explicit(&state->rings[i], memory_order_acquire);
+        free_ring = false;
+        if (ring == NULL || !atomic_compare_exchange_strong(&ring->in_use,
+            &free_ring, true))
+            continue;
+        if (atomic_load(&ring->head) == atomic_load(&ring->tail))
+            return ring;
+        atomic_store(&ring->in_use, false);
+    }
+    return NULL;
+}
+
+static binlog_ring_t *new_ring(binlog_state_t *state)
+{
+    int slot = atomic_load(&state->ring_count);
+    binlog_ring_t *ring;
+
+    do {
+        if (slot >= BINLOG_MAX_RINGS)
+            return NULL;
+    } while (!atomic_compare_exchange_weak(&state->ring_count, &slot,
+        slot + 1));
+    ring = calloc(1, sizeof(binlog_ring_t));
+    if (ring == NULL)
+        return NULL;
+    ring->id = (uint8_t)slot;
+    atomic_store(&ring->in_use, true);
+    atomic_store_explicit(&state->rings[slot], ring, memory_order_release);
+    return ring;
+}
+
+// NULL, for the rest of the thread, when all BINLOG_MAX_RINGS are taken
+binlog_ring_t *binlog_thread_ring(void)
+{
+    binlog_state_t *state = binlog_state();
+
+    if (thread_ring || thread_ringless)
+        return thread_ring;
+    pthread_once(&ring_key_once, create_ring_key);
+    thread_ring = reuse_ring(state);
+    if (thread_ring == NULL)
+        thread_ring = new_ring(state);
+    if (thread_ring == NULL) {
+        thread_ringless = true;
+        return NULL;
+    }
+    pthread_setspecific(ring_key, thread_ring);
+    return thread_ring;
+}
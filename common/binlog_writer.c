@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Background writer thread of the binary logger
+*/
+
+#include "includes/binlog_internal.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static size_t drain_all(binlog_state_t *state)
+{
+    int count = atomic_load(&state->ring_count);
+    size_t written = 0;
+    binlog_ring_t *ring;
+
+    if (count > BINLOG_MAX_RINGS)
+        count = BINLOG_MAX_RINGS;
+    for (int i = 0; i < count; i++) {
+        ring = atomic_load_explicit(&state->rings[i], memory_order_acquire);
+        if (ring)
+            written += binlog_ring_drain(ring, state->file);
+    }
+    return written;
+}
+
+static void write_dropped(binlog_state_t *state)
+{
+    uint64_t dropped = atomic_exchange(&state->dropped, 0);
+    binlog_record_t record = {0};
+    const char name[] = "Binlog";
+
+    if (dropped == 0)
+        return;
+    record.ts_ns = binlog_clock_ns(CLOCK_MONOTONIC);
+    record.kind = BINLOG_KIND_DROPPED;
+    record.len = sizeof(name) + sizeof(dropped);
+    fwrite(&record, sizeof(record), 1, state->file);
+    fwrite(name, sizeof(name), 1, state->file);
+    fwrite(&dropped, sizeof(dropped), 1, state->file);
+}
+
+static void *writer_loop(void *arg)
+{
+    binlog_state_t *state = arg;
+    struct timespec idle = {0, 1000000};
+    uint64_t now;
+
+    while (atomic_load(&state->running)) {
+        now = binlog_clock_ns(CLOCK_MONOTONIC);
+        atomic_store_explicit(&state->cached_ns, now, memory_order_relaxed);
+        if (drain_all(state) == 0)
+            nanosleep(&idle, NULL);
+        if (now - state->last_flush_ns >= BINLOG_FLUSH_NS) {
+            write_dropped(state);
+            fflush(state->file);
+            state->last_flush_ns = now;
+        }
+    }
+    drain_all(state);
+    write_dropped(state);
+    return NULL;
+}
+
+bool binlog_start_writer(binlog_state_t *state)
+{
+    atomic_store(&state->running, true);
+    state->last_flush_ns = atomic_load(&state->cached_ns);
+    if (pthread_create(&state->writer, NULL, writer_loop, state) != 0) {
+        atomic_store(&state->running, false);
+        return false;
+    }
+    return true;
+}
+
+void binlog_stop_writer(binlog_state_t *state)
+{
+    atomic_store(&state->running, false);
+    pthread_join(state->writer, NULL);
+}
@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Asynchronous binary debug logger shared by client and server
+*/
+
+#ifndef BINLOG_H_
+    #define BINLOG_H_
+
+    #include "binlog_format.h"
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <stdint.h>
+
+    #ifdef __cplusplus
+extern "C" {
+    #endif
+
+/*
+** Records are appended to a per-thread lock-free ring and written by a
+** background thread; producers never format, lock or touch the file.
+** Files are decoded offline with jetpack_logdump.
+*/
+typedef struct binlog_packet_s {
+    const char *component;
+    uint8_t direction;
+    const void *header;
+    size_t header_len;
+    const void *payload;
+    size_t payload_len;
+} binlog_packet_t;
+
+// Lifecycle
+bool binlog_open(const char *path);
+void binlog_close(void);
+bool binlog_enabled(void);
+
+// Producers (any thread)
+void binlog_text(const char *component, const char *msg, size_t len);
+void binlog_packet(const binlog_packet_t *packet);
+uint64_t binlog_now(void);
+
+    #ifdef __cplusplus
+}
+    #endif
+
+#endif /* !BINLOG_H_ */
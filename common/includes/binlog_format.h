@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** On-disk layout of binlog files
+*/
+
+#ifndef BINLOG_FORMAT_H_
+    #define BINLOG_FORMAT_H_
+
+    #include <stdint.h>
+
+    #define BINLOG_MAGIC 0x4C42504A
+    #define BINLOG_VERSION 1
+    #define BINLOG_MAX_PAYLOAD 4096
+
+    #define BINLOG_KIND_TEXT 0x01
+    #define BINLOG_KIND_PACKET 0x02
+    #define BINLOG_KIND_DROPPED 0x03
+
+    #define BINLOG_RX 0x00
+    #define BINLOG_TX 0x01
+
+/*
+** File = one binlog_file_header_t followed by records. Each record is a
+** binlog_record_t followed by `len` payload bytes: the NUL-terminated
+** component name, then the message text or the raw packet bytes.
+** Timestamps are CLOCK_MONOTONIC nanoseconds; wall time is recovered from
+** the pair captured in the file header. Fields use host byte order.
+*/
+typedef struct binlog_file_header_s {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint64_t wall_start_ns;
+    uint64_t mono_start_ns;
+} binlog_file_header_t;
+
+typedef struct binlog_record_s {
+    uint64_t ts_ns;
+    uint16_t len;
+    uint16_t orig_len;
+    uint8_t kind;
+    uint8_t thread;
+    uint8_t direction;
+    uint8_t reserved;
+} binlog_record_t;
+
+#endif /* !BINLOG_FORMAT_H_ */
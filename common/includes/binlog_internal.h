@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Internal state of the binary logger
+*/
+
+#ifndef BINLOG_INTERNAL_H_
+    #define BINLOG_INTERNAL_H_
+
+    #include "binlog.h"
+    #include "binlog_format.h"
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <stdio.h>
+
+    #define BINLOG_MAX_RINGS 32
+    #define BINLOG_RING_SIZE (1 << 16)
+    #define BINLOG_FLUSH_NS 100000000ULL
+
+typedef struct binlog_ring_s {
+    _Atomic size_t head;
+    _Atomic size_t tail;
+    atomic_bool in_use; // Cleared when the owning thread exits
+    uint8_t id;
+    uint8_t data[BINLOG_RING_SIZE];
+} binlog_ring_t;
+
+typedef struct binlog_state_s {
+    FILE *file;
+    pthread_t writer;
+    atomic_bool open;
+    atomic_bool running;
+    _Atomic uint64_t cached_ns;
+    _Atomic uint64_t dropped; // Since the last DROPPED record
+    _Atomic uint64_t dropped_total;
+    atomic_int ring_count; // Rings allocated, never above BINLOG_MAX_RINGS
+    _Atomic(binlog_ring_t *) rings[BINLOG_MAX_RINGS];
+    uint64_t last_flush_ns;
+} binlog_state_t;
+
+binlog_state_t *binlog_state(void);
+uint64_t binlog_clock_ns(int clock_id);
+
+// Rings
+binlog_ring_t *binlog_thread_ring(void);
+bool binlog_ring_push(binlog_ring_t *ring, const binlog_record_t *record,
+    const void *parts[3], const size_t sizes[3]);
+size_t binlog_ring_drain(binlog_ring_t *ring, FILE *file);
+
+// Writer thread
+bool binlog_start_writer(binlog_state_t *state);
+void binlog_stop_writer(binlog_state_t *state);
+
+#endif /* !BINLOG_INTERNAL_H_ */
@@ -0,0 +1,24 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Offline decoder for binlog files
+*/
+
+#ifndef LOGDUMP_H_
+    #define LOGDUMP_H_
+
+    #include "binlog_format.h"
+    #include <stddef.h>
+    #include <stdio.h>
+
+typedef struct logdump_entry_s {
+    binlog_record_t record;
+    size_t offset;
+} logdump_entry_t;
+
+void logdump_print_entry(const binlog_file_header_t *header,
+    const uint8_t *data, const logdump_entry_t *entry);
+const char *logdump_type_name(uint8_t type);
+
+#endif /* !LOGDUMP_H_ */
@@ -0,0 +1,81 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Match replay recording and the codec shared with replay readers
+*/
+
+#ifndef REPLAY_H_
+    #define REPLAY_H_
+
+    #include "replay_format.h"
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <stdint.h>
+
+    #define REPLAY_COLUMNS 4
+    #define REPLAY_MAX_TICK_COINS 256
+    #define REPLAY_MAX_PLAYER_BYTES (REPLAY_COLUMNS * REPLAY_MAX_PLAYERS * 5)
+
+    #ifdef __cplusplus
+extern "C" {
+    #endif
+
+// Player fields in file order, one column per field
+typedef enum replay_column_e {
+    REPLAY_X,
+    REPLAY_Y,
+    REPLAY_SCORE,
+    REPLAY_FLAGS
+} replay_column_t;
+
+typedef struct replay_columns_s {
+    uint32_t values[REPLAY_COLUMNS][REPLAY_MAX_PLAYERS];
+} replay_columns_t;
+
+// State after one tick, as handed to the writer thread
+typedef struct replay_tick_s {
+    uint32_t tick;
+    uint8_t status;
+    uint8_t winner;
+    replay_columns_t players;
+    uint32_t coin_count;
+    replay_coin_t coins[REPLAY_MAX_TICK_COINS];
+} replay_tick_t;
+
+typedef struct replay_writer_s replay_writer_t;
+
+// Codec; previous == NULL encodes a key frame
+uint32_t replay_map_hash(const uint8_t *map, size_t size);
+size_t replay_put_varint(uint8_t *out, uint32_t value);
+size_t replay_get_varint(const uint8_t *in, size_t size, uint32_t *value);
+size_t replay_encode_players(uint8_t *out, const replay_columns_t *players,
+    const replay_columns_t *previous, int count);
+// players holds the previous frame on entry; returns 0 on truncated input
+size_t replay_decode_players(const uint8_t *in, size_t size,
+    replay_columns_t *players, int count);
+
+/*
+** The tick thread fills a slot of a single-producer ring and commits it;
+** encoding and file writes happen on a background thread and committing
+** never waits for them. A full ring drops the tick: slot then returns a
+** scratch tick, the coins committed with it ride along with the next
+** tick, which becomes a key frame. The final (REPLAY_ENDED) tick is held
+** back and written by replay_writer_close, after the ring has drained,
+** together with any coins still carried. header supplies player_count,
+** the map size, start position, tick_us and keyframe_ticks (0 for
+** REPLAY_KEYFRAME_TICKS).
+*/
+replay_writer_t *replay_writer_open(const char *path,
+    const replay_file_header_t *header, const uint8_t *map);
+replay_tick_t *replay_writer_slot(replay_writer_t *writer);
+void replay_writer_commit(replay_writer_t *writer);
+// Ticks that found the ring full; their coins were kept
+uint32_t replay_writer_dropped(const replay_writer_t *writer);
+void replay_writer_close(replay_writer_t *writer);
+
+    #ifdef __cplusplus
+}
+    #endif
+
+#endif /* !REPLAY_H_ */
@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** On-disk layout of match replay files
+*/
+
+#ifndef REPLAY_FORMAT_H_
+    #define REPLAY_FORMAT_H_
+
+    #include <stdint.h>
+
+    #define REPLAY_MAGIC 0x5052504A
+    #define REPLAY_INDEX_MAGIC 0x5849504A
+    #define REPLAY_VERSION 1
+    #define REPLAY_MAX_PLAYERS 255
+    #define REPLAY_KEYFRAME_TICKS 100
+
+    #define REPLAY_FRAME_KEY 0x01
+    #define REPLAY_FRAME_DELTA 0x02
+
+    #define REPLAY_RUNNING 0x00
+    #define REPLAY_ENDED 0x01
+
+    #define REPLAY_PLAYER_ALIVE 0x01
+    #define REPLAY_PLAYER_JETPACK 0x02
+    #define REPLAY_PLAYER_COIN 0x04
+
+/*
+** File = one replay_file_header_t, the map (map_rows * map_cols bytes, row
+** major, the characters of the map file), the frames, then the seek index.
+** A frame is a replay_frame_header_t followed by `len` payload bytes: the
+** player columns (every x, then every y, every score and every flags byte,
+** each value a LEB128 varint of the zigzagged difference with the previous
+** frame), a uint32_t coin count and that many replay_coin_t. Key frames
+** diff against zero and carry every coin collected so far instead of the
+** coins of their own tick, so decoding can start at any of them. The index
+** lists one entry per key frame; tick_count and index_offset are patched
+** in on close and stay 0 when the recording was cut short, in which case
+** readers rebuild the index by walking the frames. Host byte order.
+*/
+typedef struct replay_file_header_s {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t player_count;
+    uint32_t map_hash; // FNV-1a of the map bytes
+    uint16_t map_rows;
+    uint16_t map_cols;
+    uint16_t start_x;
+    uint16_t start_y;
+    uint32_t tick_us;
+    uint32_t keyframe_ticks;
+    uint32_t tick_count;
+    uint64_t index_offset;
+} replay_file_header_t;
+
+typedef struct replay_frame_header_s {
+    uint32_t tick;
+    uint32_t len;
+    uint8_t kind;
+    uint8_t status;
+    uint8_t winner;
+    uint8_t reserved;
+} replay_frame_header_t;
+
+typedef struct replay_coin_s {
+    uint32_t coin_id; // row * map_cols + col
+    uint8_t collector;
+    uint8_t reserved[3];
+} replay_coin_t;
+
+typedef struct replay_index_header_s {
+    uint32_t magic;
+    uint32_t count;
+} replay_index_header_t;
+
+typedef struct replay_index_entry_s {
+    uint32_t tick;
+    uint32_t reserved;
+    uint64_t offset; // Of the frame header
+} replay_index_entry_t;
+
+#endif /* !REPLAY_FORMAT_H_ */
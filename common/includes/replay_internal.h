@@ -0,0 +1,60 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Internal state of the replay writer
+*/
+
+#ifndef REPLAY_INTERNAL_H_
+    #define REPLAY_INTERNAL_H_
+
+    #include "replay.h"
+    #include <pthread.h>
+    #include <stdatomic.h>
+    #include <stdio.h>
+
+    #define REPLAY_RING_SLOTS 64
+
+struct replay_writer_s {
+    FILE *file;
+    pthread_t thread;
+    atomic_bool running;
+    replay_file_header_t header;
+    replay_tick_t *ring;
+    _Atomic uint32_t head;
+    _Atomic uint32_t tail;
+    replay_columns_t previous;
+    bool has_previous;
+    uint32_t last_tick;
+    replay_coin_t *coins; // Every coin collected so far, for key frames
+    size_t coin_count;
+    size_t coin_capacity;
+    replay_index_entry_t *index;
+    size_t index_count;
+    size_t index_capacity;
+    replay_tick_t overflow; // Ring full, or the final tick held for close
+    bool overflowed;
+    bool ended; // overflow holds the REPLAY_ENDED tick
+    replay_coin_t *carry; // Coins of dropped ticks, not written yet
+    size_t carry_count;
+    size_t carry_capacity;
+    uint32_t dropped;
+    uint8_t buffer[REPLAY_MAX_PLAYER_BYTES];
+};
+
+// Tick thread side
+void replay_drop_tick(replay_writer_t *writer);
+void replay_hold_end(replay_writer_t *writer, const replay_tick_t *tick);
+void replay_carry_in(replay_writer_t *writer, replay_tick_t *tick);
+
+// Writer thread side
+size_t replay_drain(replay_writer_t *writer);
+void replay_write_tick(replay_writer_t *writer, const replay_tick_t *tick);
+// After the writer thread has stopped: the held final tick, if any
+void replay_write_end(replay_writer_t *writer);
+bool replay_grow(void **array, size_t *capacity, size_t needed, size_t size);
+bool replay_add_keyframe(replay_writer_t *writer, uint32_t tick,
+    uint64_t offset);
+void replay_write_index(replay_writer_t *writer);
+
+#endif /* !REPLAY_INTERNAL_H_ */
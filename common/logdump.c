@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Offline decoder for binlog files
+*/
+
+#include "includes/logdump.h"
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t *read_file(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    uint8_t *data;
+    long len;
+
+    if (!file)
+        return NULL;
+    fseek(file, 0, SEEK_END);
+    len = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data = malloc(len > 0 ? len : 1);
+    if (data && fread(data, 1, len, file) != (size_t)len) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *size = len > 0 ? (size_t)len : 0;
+    return data;
+}
+
+static int compare_records(const void *a, const void *b)
+{
+    const logdump_entry_t *left = a;
+    const logdump_entry_t *right = b;
+
+    if (left->record.ts_ns != right->record.ts_ns)
+        return left->record.ts_ns < right->record.ts_ns ? -1 : 1;
+    return left->offset < right->offset ? -1 : (left->offset > right->offset);
+}
+
+static logdump_entry_t *index_records(const uint8_t *data, size_t size,
+    size_t *count)
+{
+    size_t offset = sizeof(binlog_file_header_t);
+    logdump_entry_t *entries = malloc(sizeof(logdump_entry_t) *
+        (size / sizeof(binlog_record_t) + 1));
+
+    *count = 0;
+    while (entries && offset + sizeof(binlog_record_t) <= size) {
+        memcpy(&entries[*count].record, data + offset,
+            sizeof(binlog_record_t));
+        entries[*count].offset = offset + sizeof(binlog_record_t);
+        offset += sizeof(binlog_record_t) + entries[*count].record.len;
+        if (offset > size)
+            break;
+        (*count)++;
+    }
+    if (entries)
+        qsort(entries, *count, sizeof(logdump_entry_t), compare_records);
+    return entries;
+}
+
+static int dump(const uint8_t *data, size_t size)
+{
+    binlog_file_header_t header;
+    logdump_entry_t *entries;
+    size_t count = 0;
+
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != BINLOG_MAGIC || header.version != BINLOG_VERSION) {
+        fprintf(stderr, "Not a binlog file (or unsupported version)\n");
+        return 84;
+    }
+    entries = index_records(data, size, &count);
+    if (!entries)
+        return 84;
+    for (size_t i = 0; i < count; i++)
+        logdump_print_entry(&header, data, &entries[i]);
+    free(entries);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t *data;
+    size_t size = 0;
+    int ret;
+
+    if (argc != 2) {
+        printf("USAGE: ./jetpack_logdump <file.jlog>\n");
+        return argc == 1 ? 84 : 0;
+    }
+    data = read_file(argv[1], &size);
+    if (!data || size < sizeof(binlog_file_header_t)) {
+        fprintf(stderr, "Cannot read %s\n", argv[1]);
+        free(data);
+        return 84;
+    }
+    ret = dump(data, size);
+    free(data);
+    return ret;
+}
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Text rendering of decoded binlog records
+*/
+
+#include "includes/logdump.h"
+#include <string.h>
+#include <time.h>
+
+const char *logdump_type_name(uint8_t type)
+{
+    static const char *names[] = {"UNKNOWN", "CLIENT_CONNECT",
+        "SERVER_WELCOME", "MAP_CHUNK", "GAME_START", "CLIENT_INPUT",
+        "GAME_STATE", "GAME_END", "CLIENT_DISCONNECT", "DEBUG_INFO",
+        "COIN_EVENT"};
+
+    if (type >= sizeof(names) / sizeof(names[0]))
+        return names[0];
+    return names[type];
+}
+
+static void print_time(const binlog_file_header_t *header, uint64_t ts_ns)
+{
+    uint64_t wall = header->wall_start_ns + (ts_ns - header->mono_start_ns);
+    time_t seconds = (time_t)(wall / 1000000000ULL);
+    struct tm tm_info;
+    char buf[9];
+
+    localtime_r(&seconds, &tm_info);
+    strftime(buf, sizeof(buf), "%H:%M:%S", &tm_info);
+    printf("[%s.%03u]", buf, (unsigned)(wall / 1000000ULL % 1000));
+}
+
+static void print_packet(const binlog_record_t *record, const uint8_t *bytes,
+    size_t size)
+{
+    printf("%s packet: Type=0x%02x (%s), Length=%u bytes\nPayload:",
+        record->direction == BINLOG_TX ? "Sent" : "Received",
+        size > 1 ? bytes[1] : 0, logdump_type_name(size > 1 ? bytes[1] : 0),
+        record->orig_len);
+    for (size_t i = 0; i < size; i++)
+        printf("%s%02x", i % 16 == 0 && i > 0 ? "\n" : " ", bytes[i]);
+    if (size < record->orig_len)
+        printf(" ... (%u more bytes)", (unsigned)(record->orig_len - size));
+    printf("\n");
+}
+
+static void print_body(const binlog_record_t *record, const uint8_t *body,
+    size_t size)
+{
+    uint64_t dropped = 0;
+
+    switch (record->kind) {
+        case BINLOG_KIND_TEXT:
+            printf("%.*s%s\n", (int)size, (const char *)body,
+                size < record->orig_len ? " ...(truncated)" : "");
+            break;
+        case BINLOG_KIND_PACKET:
+            print_packet(record, body, size);
+            break;
+        case BINLOG_KIND_DROPPED:
+            memcpy(&dropped, body, size < 8 ? size : 8);
+            printf("%lu records dropped (ring full or none free)\n",
+                (unsigned long)dropped);
+            break;
+        default:
+            printf("<unknown record kind %u>\n", record->kind);
+    }
+}
+
+void logdump_print_entry(const binlog_file_header_t *header,
+    const uint8_t *data, const logdump_entry_t *entry)
+{
+    const char *component = (const char *)data + entry->offset;
+    size_t name_len = strnlen(component, entry->record.len);
+    size_t body_len = entry->record.len - name_len;
+
+    if (name_len < entry->record.len)
+        body_len--;
+    print_time(header, entry->record.ts_ns);
+    printf("[%.*s] ", (int)name_len, component);
+    print_body(&entry->record, (const uint8_t *)component + name_len + 1,
+        body_len);
+}
@@ -0,0 +1,57 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Column-delta encoding of the player fields of a replay frame
+*/
+
+#include "includes/replay.h"
+
+static uint32_t zigzag(uint32_t value, uint32_t previous)
+{
+    int32_t delta = (int32_t)(value - previous);
+
+    return ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+}
+
+static uint32_t unzigzag(uint32_t encoded, uint32_t previous)
+{
+    return previous + ((encoded >> 1) ^ (0u - (encoded & 1)));
+}
+
+size_t replay_encode_players(uint8_t *out, const replay_columns_t *players,
+    const replay_columns_t *previous, int count)
+{
+    size_t len = 0;
+    uint32_t base;
+
+    for (int column = 0; column < REPLAY_COLUMNS; column++) {
+        for (int i = 0; i < count; i++) {
+            base = previous ? previous->values[column][i] : 0;
+            len += replay_put_varint(out + len,
+                zigzag(players->values[column][i], base));
+        }
+    }
+    return len;
+}
+
+size_t replay_decode_players(const uint8_t *in, size_t size,
+    replay_columns_t *players, int count)
+{
+    size_t len = 0;
+    size_t used;
+    uint32_t encoded;
+    uint32_t *value;
+
+    for (int column = 0; column < REPLAY_COLUMNS; column++) {
+        for (int i = 0; i < count; i++) {
+            used = replay_get_varint(in + len, size - len, &encoded);
+            if (used == 0)
+                return 0;
+            value = &players->values[column][i];
+            *value = unzigzag(encoded, *value);
+            len += used;
+        }
+    }
+    return len;
+}
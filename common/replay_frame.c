@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Encoding of one tick into a key or delta replay frame
+*/
+
+#include "includes/replay_internal.h"
+#include <string.h>
+
+static bool is_keyframe(const replay_writer_t *writer,
+    const replay_tick_t *tick)
+{
+    if (!writer->has_previous || tick->tick != writer->last_tick + 1)
+        return true;
+    return tick->tick % writer->header.keyframe_ticks == 0;
+}
+
+static void append_coins(replay_writer_t *writer, const replay_coin_t *coins,
+    size_t count)
+{
+    size_t needed = writer->coin_count + count;
+
+    if (!replay_grow((void **)&writer->coins, &writer->coin_capacity,
+        needed, sizeof(replay_coin_t)))
+        return;
+    memcpy(writer->coins + writer->coin_count, coins,
+        count * sizeof(replay_coin_t));
+    writer->coin_count = needed;
+}
+
+static void write_frame(replay_writer_t *writer, replay_frame_header_t *frame,
+    const replay_coin_t *coins, uint32_t coin_count)
+{
+    size_t players_len = frame->len;
+
+    frame->len += sizeof(coin_count) + coin_count * sizeof(replay_coin_t);
+    fwrite(frame, sizeof(*frame), 1, writer->file);
+    fwrite(writer->buffer, 1, players_len, writer->file);
+    fwrite(&coin_count, sizeof(coin_count), 1, writer->file);
+    fwrite(coins, sizeof(replay_coin_t), coin_count, writer->file);
+}
+
+void replay_write_tick(replay_writer_t *writer, const replay_tick_t *tick)
+{
+    bool key = is_keyframe(writer, tick);
+    replay_frame_header_t frame = {tick->tick, 0,
+        key ? REPLAY_FRAME_KEY : REPLAY_FRAME_DELTA, tick->status,
+        tick->winner, 0};
+
+    append_coins(writer, tick->coins, tick->coin_count);
+    if (key)
+        replay_add_keyframe(writer, tick->tick, ftell(writer->file));
+    frame.len = replay_encode_players(writer->buffer, &tick->players,
+        key ? NULL : &writer->previous, writer->header.player_count);
+    if (key)
+        write_frame(writer, &frame, writer->coins, writer->coin_count);
+    else
+        write_frame(writer, &frame, tick->coins, tick->coin_count);
+    memcpy(&writer->previous, &tick->players, sizeof(replay_columns_t));
+    writer->has_previous = true;
+    writer->last_tick = tick->tick;
+    writer->header.tick_count++;
+}
+
+// Coins still carried go in a key frame, which lists every coin so far
+void replay_write_end(replay_writer_t *writer)
+{
+    if (!writer->ended)
+        return;
+    if (writer->carry_count > 0) {
+        append_coins(writer, writer->carry, writer->carry_count);
+        writer->carry_count = 0;
+        writer->has_previous = false;
+    }
+    replay_write_tick(writer, &writer->overflow);
+    writer->ended = false;
+}
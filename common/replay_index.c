@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Seek index of replay files
+*/
+
+#include "includes/replay_internal.h"
+#include <stdlib.h>
+
+bool replay_grow(void **array, size_t *capacity, size_t needed, size_t size)
+{
+    size_t wanted = *capacity ? *capacity : 64;
+    void *grown;
+
+    if (needed <= *capacity)
+        return true;
+    while (wanted < needed)
+        wanted *= 2;
+    grown = realloc(*array, wanted * size);
+    if (grown == NULL)
+        return false;
+    *array = grown;
+    *capacity = wanted;
+    return true;
+}
+
+bool replay_add_keyframe(replay_writer_t *writer, uint32_t tick,
+    uint64_t offset)
+{
+    replay_index_entry_t *entry;
+
+    if (!replay_grow((void **)&writer->index, &writer->index_capacity,
+        writer->index_count + 1, sizeof(replay_index_entry_t)))
+        return false;
+    entry = &writer->index[writer->index_count];
+    entry->tick = tick;
+    entry->reserved = 0;
+    entry->offset = offset;
+    writer->index_count++;
+    return true;
+}
+
+void replay_write_index(replay_writer_t *writer)
+{
+    replay_index_header_t index = {REPLAY_INDEX_MAGIC,
+        (uint32_t)writer->index_count};
+    long offset = ftell(writer->file);
+
+    if (offset < 0)
+        return;
+    fwrite(&index, sizeof(index), 1, writer->file);
+    fwrite(writer->index, sizeof(replay_index_entry_t), writer->index_count,
+        writer->file);
+    writer->header.index_offset = (uint64_t)offset;
+    fseek(writer->file, 0, SEEK_SET);
+    fwrite(&writer->header, sizeof(writer->header), 1, writer->file);
+}
@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Dropped ticks and the held final tick, producer side
+*/
+
+#include "includes/replay_internal.h"
+#include <string.h>
+
+// Coins of a dropped tick wait for the next committed one, so key frames
+// still list every coin collected during the match
+static void carry_out(replay_writer_t *writer, const replay_tick_t *tick)
+{
+    if (!replay_grow((void **)&writer->carry, &writer->carry_capacity,
+        writer->carry_count + tick->coin_count, sizeof(replay_coin_t)))
+        return;
+    memcpy(writer->carry + writer->carry_count, tick->coins,
+        tick->coin_count * sizeof(replay_coin_t));
+    writer->carry_count += tick->coin_count;
+}
+
+void replay_carry_in(replay_writer_t *writer, replay_tick_t *tick)
+{
+    size_t room = REPLAY_MAX_TICK_COINS - tick->coin_count;
+    size_t moved = writer->carry_count < room ? writer->carry_count : room;
+
+    if (moved == 0)
+        return;
+    memcpy(tick->coins + tick->coin_count, writer->carry,
+        moved * sizeof(replay_coin_t));
+    tick->coin_count += moved;
+    writer->carry_count -= moved;
+    memmove(writer->carry, writer->carry + moved,
+        writer->carry_count * sizeof(replay_coin_t));
+}
+
+// The running tick was built in writer->overflow because the ring is full
+void replay_drop_tick(replay_writer_t *writer)
+{
+    writer->dropped++;
+    carry_out(writer, &writer->overflow);
+}
+
+/*
+** The final tick is not published: replay_writer_close writes it once the
+** writer thread has drained the ring, with whatever coins are still carried.
+*/
+void replay_hold_end(replay_writer_t *writer, const replay_tick_t *tick)
+{
+    if (tick != &writer->overflow)
+        memcpy(&writer->overflow, tick, sizeof(*tick));
+    writer->ended = true;
+}
+
+uint32_t replay_writer_dropped(const replay_writer_t *writer)
+{
+    return writer == NULL ? 0 : writer->dropped;
+}
@@ -0,0 +1,53 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Single-producer tick ring between the game loop and the replay writer
+*/
+
+#include "includes/replay_internal.h"
+
+// Never NULL: a full ring hands out writer->overflow instead
+replay_tick_t *replay_writer_slot(replay_writer_t *writer)
+{
+    uint32_t head = atomic_load_explicit(&writer->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&writer->tail, memory_order_acquire);
+
+    writer->overflowed = head - tail >= REPLAY_RING_SLOTS;
+    if (writer->overflowed)
+        return &writer->overflow;
+    return &writer->ring[head % REPLAY_RING_SLOTS];
+}
+
+// Never waits on the writer thread, see replay_writer_close for the end
+void replay_writer_commit(replay_writer_t *writer)
+{
+    uint32_t head = atomic_load_explicit(&writer->head, memory_order_relaxed);
+    replay_tick_t *tick = writer->overflowed ? &writer->overflow :
+        &writer->ring[head % REPLAY_RING_SLOTS];
+
+    if (tick->status == REPLAY_ENDED) {
+        replay_hold_end(writer, tick);
+        return;
+    }
+    if (writer->overflowed) {
+        replay_drop_tick(writer);
+        return;
+    }
+    replay_carry_in(writer, tick);
+    atomic_fetch_add_explicit(&writer->head, 1, memory_order_release);
+}
+
+size_t replay_drain(replay_writer_t *writer)
+{
+    uint32_t head = atomic_load_explicit(&writer->head, memory_order_acquire);
+    uint32_t tail = atomic_load_explicit(&writer->tail, memory_order_relaxed);
+    size_t written = 0;
+
+    for (; tail != head; tail++) {
+        replay_write_tick(writer, &writer->ring[tail % REPLAY_RING_SLOTS]);
+        atomic_store_explicit(&writer->tail, tail + 1, memory_order_release);
+        written++;
+    }
+    return written;
+}
@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Varints and map hashing of the replay format
+*/
+
+#include "includes/replay.h"
+
+uint32_t replay_map_hash(const uint8_t *map, size_t size)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < size; i++) {
+        hash ^= map[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+size_t replay_put_varint(uint8_t *out, uint32_t value)
+{
+    size_t len = 0;
+
+    while (value >= 0x80) {
+        out[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[len++] = (uint8_t)value;
+    return len;
+}
+
+size_t replay_get_varint(const uint8_t *in, size_t size, uint32_t *value)
+{
+    uint32_t result = 0;
+
+    for (size_t i = 0; i < size && i < 5; i++) {
+        result |= (uint32_t)(in[i] & 0x7F) << (7 * i);
+        if ((in[i] & 0x80) == 0) {
+            *value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Replay file lifecycle and background writer thread
+*/
+
+#include "includes/replay_internal.h"
+#include <stdlib.h>
+#include <time.h>
+
+static void *writer_loop(void *arg)
+{
+    replay_writer_t *writer = arg;
+    struct timespec idle = {0, 1000000};
+
+    while (atomic_load(&writer->running)) {
+        if (replay_drain(writer) > 0)
+            continue;
+        fflush(writer->file);
+        nanosleep(&idle, NULL);
+    }
+    replay_drain(writer);
+    return NULL;
+}
+
+static bool write_preamble(replay_writer_t *writer,
+    const replay_file_header_t *header, const uint8_t *map)
+{
+    size_t map_size = (size_t)header->map_rows * header->map_cols;
+
+    writer->header = *header;
+    writer->header.magic = REPLAY_MAGIC;
+    writer->header.version = REPLAY_VERSION;
+    writer->header.map_hash = replay_map_hash(map, map_size);
+    if (writer->header.keyframe_ticks == 0)
+        writer->header.keyframe_ticks = REPLAY_KEYFRAME_TICKS;
+    writer->header.tick_count = 0;
+    writer->header.index_offset = 0;
+    return fwrite(&writer->header, sizeof(writer->header), 1,
+        writer->file) == 1 && fwrite(map, 1, map_size, writer->file) ==
+        map_size;
+}
+
+static void free_writer(replay_writer_t *writer)
+{
+    if (writer->file != NULL)
+        fclose(writer->file);
+    free(writer->ring);
+    free(writer->coins);
+    free(writer->index);
+    free(writer->carry);
+    free(writer);
+}
+
+replay_writer_t *replay_writer_open(const char *path,
+    const replay_file_header_t *header, const uint8_t *map)
+{
+    replay_writer_t *writer = calloc(1, sizeof(replay_writer_t));
+
+    if (writer == NULL)
+        return NULL;
+    writer->ring = calloc(REPLAY_RING_SLOTS, sizeof(replay_tick_t));
+    writer->file = fopen(path, "wb");
+    if (writer->ring == NULL || writer->file == NULL ||
+        header->player_count > REPLAY_MAX_PLAYERS ||
+        !write_preamble(writer, header, map)) {
+        free_writer(writer);
+        return NULL;
+    }
+    atomic_store(&writer->running, true);
+    if (pthread_create(&writer->thread, NULL, writer_loop, writer) != 0) {
+        free_writer(writer);
+        return NULL;
+    }
+    return writer;
+}
+
+void replay_writer_close(replay_writer_t *writer)
+{
+    if (writer == NULL)
+        return;
+    atomic_store(&writer->running, false);
+    pthread_join(writer->thread, NULL);
+    replay_write_end(writer);
+    replay_write_index(writer);
+    free_writer(writer);
+}
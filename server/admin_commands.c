@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Admin socket command dispatch and live settings
+*/
+
+#include "includes/server.h"
+#include "binlog.h"
+
+// Settings are atomics; only the dumps need the tick to be idle
+typedef struct admin_command_s {
+    const char *name;
+    void (*run)(server_t *server, char *arg, FILE *out);
+    bool locked;
+} admin_command_t;
+
+static void admin_tick_rate(server_t *server, char *arg, FILE *out)
+{
+    int hz = arg ? atoi(arg) : 0;
+
+    if (hz < 1 || hz > 1000) {
+        fprintf(out, "tick_rate %.2f Hz (set with: tick_rate <1-1000>)\n",
+            1e6 / atomic_load(&server->tick_us));
+        return;
+    }
+    atomic_store(&server->tick_us, 1000000 / hz);
+    fprintf(out, "ok tick_rate %d Hz (%u us)\n", hz,
+        atomic_load(&server->tick_us));
+}
+
+static void admin_send_every(server_t *server, char *arg, FILE *out)
+{
+    int interval = arg ? atoi(arg) : 0;
+
+    if (interval < 1 || interval > 100) {
+        fprintf(out, "send_every %u ticks (set with: send_every <1-100>)\n",
+            atomic_load(&server->state_interval));
+        return;
+    }
+    atomic_store(&server->state_interval, interval);
+    fprintf(out, "ok GAME_STATE sent every %d ticks\n", interval);
+}
+
+static void admin_debug(server_t *server, char *arg, FILE *out)
+{
+    if (arg != NULL && strcmp(arg, "on") == 0) {
+        server->debug_mode = true;
+        if (!binlog_enabled())
+            open_debug_log(server);
+    } else if (arg != NULL && strcmp(arg, "off") == 0)
+        server->debug_mode = false;
+    fprintf(out, "debug %s\n", server->debug_mode ? "on" : "off");
+}
+
+static void admin_help(server_t *server, char *arg, FILE *out)
+{
+    (void)server;
+    (void)arg;
+    fprintf(out, "tick_rate [hz]      show or set the tick rate\n"
+        "send_every [ticks]  show or set the GAME_STATE interval\n"
+        "debug [on|off]      show or toggle the packet debug log\n"
+        "clients             dump per-client game state\n"
+        "stats               dump tick and connection statistics\n"
+        "snapshot [path]     write the map and players to a file\n");
+}
+
+static const admin_command_t COMMANDS[] = {
+    {"tick_rate", admin_tick_rate, false},
+    {"send_every", admin_send_every, false},
+    {"debug", admin_debug, false}, {"clients", admin_dump_clients, true},
+    {"stats", admin_dump_stats, true}, {"snapshot", admin_snapshot, true},
+    {"help", admin_help, false}
+};
+
+void admin_execute(server_t *server, char *line, FILE *out)
+{
+    char *save = NULL;
+    char *name = strtok_r(line, " \t\r\n", &save);
+
+    if (name == NULL)
+        return;
+    for (size_t i = 0; i < sizeof(COMMANDS) / sizeof(COMMANDS[0]); i++) {
+        if (strcmp(name, COMMANDS[i].name) != 0)
+            continue;
+        if (COMMANDS[i].locked)
+            pthread_mutex_lock(&server->state_lock);
+        COMMANDS[i].run(server, strtok_r(NULL, " \t\r\n", &save), out);
+        if (COMMANDS[i].locked)
+            pthread_mutex_unlock(&server->state_lock);
+        return;
+    }
+    fprintf(out, "unknown command '%s', try 'help'\n", name);
+}
@@ -0,0 +1,101 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Admin socket state dumps and snapshots
+*/
+
+#include "includes/server.h"
+#include <linux/sockios.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+
+void admin_dump_clients(server_t *server, char *arg, FILE *out)
+{
+    client_t *client;
+    sim_player_t *player;
+    char ip[INET_ADDRSTRLEN];
+
+    (void)arg;
+    fprintf(out, "tick %u, %d clients\n", server->tick, server->client_count);
+    for (int i = 0; i < server->client_count; i++) {
+        client = server->client[i];
+        player = &server->sim.players[i];
+        inet_ntop(AF_INET, &client->addr.sin_addr, ip, sizeof(ip));
+        fprintf(out, "id=%u fd=%d addr=%s:%u x=%u y=%u score=%d alive=%d "
+            "jetpack=%d\n", client->id, client->fd, ip,
+            ntohs(client->addr.sin_port), player->x, player->y,
+            player->score, player->alive, player->jetpack);
+    }
+}
+
+static void dump_connection(FILE *out, client_t *client)
+{
+    struct tcp_info info;
+    socklen_t len = sizeof(info);
+    int queued = 0;
+    int pending = 0;
+
+    ioctl(client->fd, SIOCOUTQ, &queued);
+    ioctl(client->fd, SIOCINQ, &pending);
+    if (getsockopt(client->fd, IPPROTO_TCP, TCP_INFO, &info, &len) == -1) {
+        fprintf(out, "id=%u fd=%d tcp_info unavailable\n", client->id,
+            client->fd);
+        return;
+    }
+    fprintf(out, "id=%u fd=%d rtt=%.3fms rttvar=%.3fms retrans=%u "
+        "unacked=%u send_queue=%d recv_queue=%d\n", client->id, client->fd,
+        info.tcpi_rtt / 1e3, info.tcpi_rttvar / 1e3, info.tcpi_total_retrans,
+        info.tcpi_unacked, queued, pending);
+}
+
+void admin_dump_stats(server_t *server, char *arg, FILE *out)
+{
+    metrics_t *metrics = metrics_get();
+
+    (void)arg;
+    fprintf(out, "tick=%u tick_us=%u send_every=%u debug=%d matches=%llu "
+        "overruns=%llu worst_tick=%.3fms\n", server->tick,
+        atomic_load(&server->tick_us), atomic_load(&server->state_interval),
+        server->debug_mode, (unsigned long long)
+        atomic_load(&metrics->matches_started), (unsigned long long)
+        server->profiler.total_overruns, server->profiler.worst_tick_ns / 1e6);
+    for (int i = 0; i < server->client_count; i++)
+        dump_connection(out, server->client[i]);
+}
+
+static void write_snapshot(server_t *server, FILE *file)
+{
+    const sim_map_t *map = &server->sim.map;
+    const sim_player_t *player;
+
+    fprintf(file, "tick %u\nmap %zu %zu\n", server->tick, map->row_count,
+        map->col_count);
+    for (int i = 0; i < server->sim.player_count; i++) {
+        player = &server->sim.players[i];
+        fprintf(file, "player %d %u %u %d %d %d\n", i, player->x, player->y,
+            player->score, player->alive, player->jetpack);
+    }
+    for (size_t row = 0; row < map->row_count; row++)
+        fprintf(file, "%.*s\n", (int)strcspn(map->rows[row], "\n"),
+            map->rows[row]);
+}
+
+void admin_snapshot(server_t *server, char *arg, FILE *out)
+{
+    char path[64];
+    FILE *file;
+
+    if (arg == NULL) {
+        snprintf(path, sizeof(path), "snapshot_%u.txt", server->tick);
+        arg = path;
+    }
+    file = fopen(arg, "w");
+    if (file == NULL) {
+        fprintf(out, "error: cannot open %s\n", arg);
+        return;
+    }
+    write_snapshot(server, file);
+    fclose(file);
+    fprintf(out, "ok snapshot written to %s\n", arg);
+}
@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Unix-domain admin socket served from its own thread
+*/
+
+#include "includes/server.h"
+#include <sys/stat.h>
+
+static int open_admin_socket(const char *path)
+{
+    struct sockaddr_un addr = {0};
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd == -1 || strlen(path) >= sizeof(addr.sun_path))
+        return -1;
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1 ||
+        chmod(path, 0600) == -1 || listen(fd, 4) == -1) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void serve_admin_client(server_t *server, int fd)
+{
+    FILE *in = fdopen(dup(fd), "r");
+    char *line = NULL;
+    size_t line_size = 0;
+    char *reply;
+    size_t reply_size;
+    FILE *out;
+
+    while (in != NULL && getline(&line, &line_size, in) > 0) {
+        out = open_memstream(&reply, &reply_size);
+        if (out == NULL)
+            break;
+        admin_execute(server, line, out);
+        fclose(out);
+        send(fd, reply, reply_size, MSG_NOSIGNAL);
+        free(reply);
+    }
+    free(line);
+    if (in != NULL)
+        fclose(in);
+}
+
+static void *admin_thread(void *arg)
+{
+    server_t *server = arg;
+    int fd;
+
+    while (1) {
+        fd = accept(server->admin_fd, NULL, NULL);
+        if (fd == -1)
+            continue;
+        serve_admin_client(server, fd);
+        close(fd);
+    }
+    return NULL;
+}
+
+void admin_start(server_t *server)
+{
+    pthread_t thread;
+
+    if (server->admin_path == NULL)
+        return;
+    server->admin_fd = open_admin_socket(server->admin_path);
+    if (server->admin_fd == -1) {
+        perror("admin socket");
+        return;
+    }
+    if (pthread_create(&thread, NULL, admin_thread, server) != 0) {
+        perror("pthread_create admin");
+        return;
+    }
+    pthread_detach(thread);
+    printf("Admin commands accepted on %s\n", server->admin_path);
+}
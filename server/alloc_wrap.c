@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Allocation counters, linked in with -Wl,--wrap (see CMakeLists.txt)
+*/
+
+#include "includes/server.h"
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size)
+{
+    metrics_t *metrics = metrics_get();
+
+    atomic_fetch_add_explicit(&metrics->allocs, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&metrics->alloc_bytes, size,
+        memory_order_relaxed);
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    metrics_t *metrics = metrics_get();
+
+    atomic_fetch_add_explicit(&metrics->allocs, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&metrics->alloc_bytes, count * size,
+        memory_order_relaxed);
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    metrics_t *metrics = metrics_get();
+
+    if (ptr == NULL)
+        atomic_fetch_add_explicit(&metrics->allocs, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&metrics->alloc_bytes, size,
+        memory_order_relaxed);
+    return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void *ptr)
+{
+    if (ptr != NULL)
+        atomic_fetch_add_explicit(&metrics_get()->frees, 1,
+            memory_order_relaxed);
+    __real_free(ptr);
+}
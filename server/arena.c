@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Bump arenas for the buffers of one tick or one match
+*/
+
+#include "includes/server.h"
+
+static bool arena_push_block(arena_t *arena, size_t size)
+{
+    arena_block_t *block = malloc(sizeof(arena_block_t) + size);
+
+    if (block == NULL)
+        return false;
+    block->next = arena->head;
+    block->size = size;
+    block->used = 0;
+    arena->head = block;
+    return true;
+}
+
+bool arena_init(arena_t *arena, size_t size)
+{
+    arena->head = NULL;
+    return arena_push_block(arena, size);
+}
+
+// Only spills into a new block the first time a cycle outgrows the arena
+void *arena_alloc(arena_t *arena, size_t size)
+{
+    arena_block_t *block = arena->head;
+    size_t grown;
+    void *data;
+
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if (block == NULL || block->size - block->used < size) {
+        grown = block == NULL ? size : block->size * 2;
+        if (!arena_push_block(arena, grown < size ? size : grown))
+            return NULL;
+        block = arena->head;
+    }
+    data = block->data + block->used;
+    block->used += size;
+    return data;
+}
+
+// A cycle that spilled leaves one block big enough for all of it
+void arena_reset(arena_t *arena)
+{
+    size_t total = 0;
+
+    if (arena->head == NULL || arena->head->next == NULL) {
+        if (arena->head != NULL)
+            arena->head->used = 0;
+        return;
+    }
+    for (arena_block_t *block = arena->head; block; block = block->next)
+        total += block->size;
+    arena_destroy(arena);
+    arena_push_block(arena, total);
+}
+
+void arena_destroy(arena_t *arena)
+{
+    arena_block_t *next;
+
+    while (arena->head != NULL) {
+        next = arena->head->next;
+        free(arena->head);
+        arena->head = next;
+    }
+}
@@ -42,13 +42,45 @@ bool check_path_map(char *map)
     return true;
 }
 
+int option_arity(const char *option)
+{
+    if (strcmp(option, "-d") == 0 || strcmp(option, "-P") == 0)
+        return 0;
+    if (strcmp(option, "-t") == 0 || strcmp(option, "-M") == 0 ||
+        strcmp(option, "-a") == 0 || strcmp(option, "-n") == 0 ||
+        strcmp(option, "-r") == 0 || strcmp(option, "-L") == 0 ||
+        strcmp(option, "-c") == 0)
+        return 1;
+    return -1;
+}
+
+int check_options(int argc, char **argv)
+{
+    int arity;
+
+    for (int i = 5; i < argc; i += arity + 1) {
+        arity = option_arity(argv[i]);
+        if (arity < 0 || i + arity >= argc) {
+            fprintf(stderr, "Unknown option or missing value: %s\n", argv[i]);
+            return 84;
+        }
+        if (strcmp(argv[i], "-n") == 0 && (atoi(argv[i + 1]) < 1 ||
+            atoi(argv[i + 1]) > MAX_PLAYERS)) {
+            fprintf(stderr, "Players must be between 1 and %d\n",
+                MAX_PLAYERS);
+            return 84;
+        }
+    }
+    return 0;
+}
+
 int check_args(int argc, char **argv)
 {
-    if (argc < 5 || argc > 6)
+    if (argc < 5)
         return 84;
     if (strcmp(argv[1], "-p") != 0 || strcmp(argv[3], "-m") != 0)
         return 84;
     if (!check_port(argv[2]) || !check_path_map(argv[4]))
         return 84;
-    return 0;
+    return check_options(argc, argv);
 }
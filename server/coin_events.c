@@ -0,0 +1,43 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Batched coin-collected events
+*/
+
+#include "includes/server.h"
+
+void write_coin_events_payload(uint8_t *buffer, server_t *server)
+{
+    size_t offset = 10;
+    const sim_coin_event_t *event;
+
+    write_state_payload(buffer, server, 0);
+    buffer[8] = (server->sim.coin_event_count >> 8) & 0xFF;
+    buffer[9] = server->sim.coin_event_count & 0xFF;
+    for (int i = 0; i < server->sim.coin_event_count; i++) {
+        event = &server->sim.coin_events[i];
+        buffer[offset] = (event->coin_id >> 24) & 0xFF;
+        buffer[offset + 1] = (event->coin_id >> 16) & 0xFF;
+        buffer[offset + 2] = (event->coin_id >> 8) & 0xFF;
+        buffer[offset + 3] = event->coin_id & 0xFF;
+        buffer[offset + 4] = event->collector;
+        offset += 5;
+    }
+}
+
+void send_coin_events(server_t *server)
+{
+    uint8_t buffer[10 + SIM_MAX_COIN_EVENTS * 5];
+    uint16_t length = 10 + server->sim.coin_event_count * 5;
+
+    if (server->sim.coin_event_count == 0)
+        return;
+    write_header(buffer, COIN_EVENT, length);
+    write_coin_events_payload(buffer, server);
+    for (int i = 0; i < server->client_count; i++) {
+        if (!send_with_write(server->client[i]->fd, buffer, length))
+            perror("send_with_write COIN_EVENT");
+        print_debug_info_package_sent(server, buffer, length);
+    }
+}
@@ -40,14 +40,13 @@ int check_payload_length(uint16_t payload_length, server_t *server, int i)
         close(server->client[i]->fd);
         return 84;
     }
+    metrics_count_packet(METRICS_RX, server->message_type, payload_length);
     return 0;
 }
 
-int check_read(int read_ret, char *payload)
+int check_read(int read_ret)
 {
-    if (read_ret <= 0) {
-        free(payload);
+    if (read_ret <= 0)
         return 84;
-    }
     return 0;
 }
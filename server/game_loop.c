@@ -7,56 +7,41 @@
 
 #include "includes/server.h"
 
-void check_win(client_t *client, uint8_t *winner_id, int *max_score, int i)
-{
-    if (client->x >= 999 && client->is_alive) {
-        if (client->score > *max_score) {
-            *max_score = client->score;
-            *winner_id = i;
-        }
-    }
-}
-
-int check_life(client_t *client, int alive_count, uint8_t *alive_player_id,
-    int i)
-{
-    if (client->is_alive) {
-        alive_count++;
-        *alive_player_id = i;
-    }
-    return alive_count;
-}
-
 void update_game_state(server_t *server)
 {
-    client_t *client;
-    uint8_t alive_player_id = 0xFF;
-    int alive_count = 0;
-    uint8_t winner_id = 0xFF;
-    int max_score = -1;
+    uint64_t start = prof_now();
+    uint32_t sim_tick = server->sim.tick;
 
-    if (!initialize_alive_tracking(server, &alive_count, &alive_player_id))
-        return;
-    for (int i = 0; i < server->client_count; i++) {
-        client = server->client[i];
-        read_client(server, i);
-        process_client_state(client, server);
-        check_win(client, &winner_id, &max_score, i);
-        alive_count = check_life(client, alive_count, &alive_player_id, i);
-    }
-    if (winner_id != 0xFF) {
-        send_game_end(server, 2, winner_id);
-    } else if (!client->is_alive ||
-        (alive_count == 1 && server->client_count > 1))
-        send_game_end(server, 2, alive_player_id);
+    read_ready_clients(server);
+    start = prof_record(server, PHASE_INPUT, start);
+    sim_step(&server->sim, NULL);
+    probe_step(server);
+    if (server->sim.tick != sim_tick)
+        replay_capture(server);
+    start = prof_record(server, PHASE_SIMULATE, start);
+    if (server->sim.status == SIM_ENDED)
+        send_game_end(server, 2, server->sim.winner);
+    prof_record(server, PHASE_GAME_END, start);
 }
 
 void game_loop(server_t *server)
 {
-    while (1) {
-        usleep(50000);
+    uint64_t start;
+
+    while (server->sim.status == SIM_RUNNING) {
+        usleep(atomic_load(&server->tick_us));
+        pthread_mutex_lock(&server->state_lock);
+        prof_begin_tick(server);
+        arena_reset(&server->tick_arena);
         update_game_state(server);
-        send_game_state_to_all_clients(server);
+        start = prof_now();
+        if (server->tick % atomic_load(&server->state_interval) == 0)
+            send_game_state_to_all_clients(server);
+        start = prof_record(server, PHASE_STATE, start);
+        send_coin_events(server);
+        prof_record(server, PHASE_EVENTS, start);
+        prof_end_tick(server);
         server->tick++;
+        pthread_mutex_unlock(&server->state_lock);
     }
 }
@@ -20,6 +20,8 @@ char *get_type_string_next(uint8_t type)
             return "CLIENT_DISCONNECT";
         case DEBUG_INFO:
             return "DEBUG_INFO";
+        case COIN_EVENT:
+            return "COIN_EVENT";
     }
     return "UNKNOWN_TYPE";
 }
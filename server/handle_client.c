@@ -9,32 +9,29 @@
 
 client_t *set_values_to_client(client_t *new_client, server_t *server)
 {
-    new_client->score = 0;
-    new_client->is_alive = true;
-    new_client->x = server->start_x;
-    new_client->y = server->start_y;
-    new_client->jetpack = false;
+    new_client->id = (uint8_t)server->client_count;
+    sim_add_player(&server->sim);
+    metrics_track_fd(new_client->fd, true);
+    probe_watch(server, new_client->fd);
     return new_client;
 }
 
 void accept_client(server_t *server)
 {
-    client_t *new_client = malloc(sizeof(client_t));
+    client_t *new_client = slab_alloc(&server->client_pool);
 
     if (!new_client)
-        handle_error("malloc", server);
+        handle_error("slab_alloc", server);
     memset(new_client, 0, sizeof(client_t));
     new_client->addr_len = sizeof(new_client->addr);
     new_client->fd = accept(server->fd, (struct sockaddr *) &new_client->addr,
         &new_client->addr_len);
     if (new_client->fd == -1) {
         perror("accept");
-        free(new_client);
+        slab_free(&server->client_pool, new_client);
         return;
     }
     new_client = set_values_to_client(new_client, server);
-    server->client = realloc(server->client,
-        (server->client_count + 1) * sizeof(client_t *));
     server->client[server->client_count] = new_client;
     server->fds[server->nfds].fd = new_client->fd;
     server->fds[server->nfds].events = POLLIN;
@@ -59,23 +56,21 @@ void loop_clients(server_t *server, int current_idx)
 {
     if (server->fds[current_idx].revents & POLLIN) {
         if (server->fds[current_idx].fd == server->fd &&
-            server->client_count < MAX_CLIENTS) {
+            server->client_count < server->max_clients) {
+            pthread_mutex_lock(&server->state_lock);
             accept_client(server);
             server->client_count++;
+            pthread_mutex_unlock(&server->state_lock);
         } else
             check_read_client(server, current_idx);
     }
 }
 
+// Returns once the last player of the match sent CLIENT_CONNECT
 void handle_clients(server_t *server)
 {
-    server->client = calloc(MAX_CLIENTS, sizeof(client_t *));
-    server->client_count = 0;
-    server->fds = malloc(sizeof(struct pollfd) * (MAX_CLIENTS + 1));
-    server->nfds = 1;
-    server->fds[0].fd = server->fd;
-    server->fds[0].events = POLLIN;
-    while (1) {
+    while (!server->lobby_full) {
+        arena_reset(&server->tick_arena);
         if (poll(server->fds, server->nfds, -1) == -1)
             handle_error("poll", server);
         for (int current_idx = 0; current_idx < server->nfds; current_idx++)
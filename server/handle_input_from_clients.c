@@ -16,10 +16,9 @@ void handle_input(server_t *server, int client_id, char *payload)
         return;
     player_id = payload[0];
     jetpack_status = payload[1];
-    if (jetpack_status == 1)
-        server->client[player_id]->jetpack = true;
-    else if (jetpack_status == 0)
-        server->client[player_id]->jetpack = false;
-    else
+    if (jetpack_status == 1 || jetpack_status == 0) {
+        sim_set_input(&server->sim, player_id, jetpack_status == 1);
+        probe_input(server, player_id, jetpack_status);
+    } else
         fprintf(stderr, "Invalid jetpack status: %d\n", jetpack_status);
 }
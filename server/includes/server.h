@@ -19,11 +19,17 @@
 #include <stdbool.h>
 #include <ctype.h>
 #include <sys/wait.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "sim.h"
+#include "replay.h"
 
 #ifndef SERVER_H_
     #define SERVER_H_
 
-    #define MAX_CLIENTS 2
+    #define DEFAULT_MAX_CLIENTS 2
+    #define MAX_PLAYERS SIM_MAX_PLAYERS
     #define MAGIC_BYTE 0xAB
     #define CLIENT_CONNECT 0x01
     #define SERVER_WELCOME 0x02
@@ -34,8 +40,20 @@
     #define GAME_END 0x07
     #define CLIENT_DISCONNECT 0x08
     #define DEBUG_INFO 0x09
+    #define COIN_EVENT 0x0A
+    #define DEFAULT_TICK_US 50000
+    #define READ_BURST 8 // Packets read per client and tick at most
+    #define PROF_BUCKETS 160
+    #define PROF_SUMMARY_TICKS 200
+    #define METRICS_MAX_TYPES 16
+    #define METRICS_MAX_FDS MAX_PLAYERS
+    #define METRICS_TICK_BUCKETS 10
+    #define ARENA_ALIGN 16
+    #define ARENA_TICK_SIZE 16384
+    #define ARENA_MATCH_SIZE 65536
 
 typedef struct client_s {
+    uint8_t id;
     int fd;
     struct sockaddr_in addr;
     socklen_t addr_len;
@@ -45,22 +63,104 @@ typedef struct client_s {
     char ip[INET_ADDRSTRLEN];
     int data_port;
     int data_fd;
-    int score;
-    bool is_alive;
-    uint16_t x;
-    uint16_t y;
-    bool jetpack;
-    bool collected_coin;
 } client_t;
 
+// Bump allocator: nothing is freed before arena_reset, which folds the
+// blocks a cycle spilled into one, so after the busiest tick (or match)
+// has been seen a cycle runs without calling malloc
+typedef struct arena_block_s {
+    struct arena_block_s *next;
+    size_t size;
+    size_t used;
+    _Alignas(ARENA_ALIGN) uint8_t data[];
+} arena_block_t;
+
+typedef struct arena_s {
+    arena_block_t *head; // Block allocations are taken from
+} arena_t;
+
+// Fixed-size slots carved out of one allocation, the free ones are stacked
+typedef struct slab_pool_s {
+    uint8_t *slots;
+    void **free_slots;
+    size_t slot_size;
+    size_t capacity;
+    size_t free_count;
+} slab_pool_t;
+
+// Timed sections of one game tick, PHASE_TICK covers the whole tick
+typedef enum tick_phase_e {
+    PHASE_INPUT,
+    PHASE_SIMULATE,
+    PHASE_GAME_END,
+    PHASE_STATE,
+    PHASE_EVENTS,
+    PHASE_TICK,
+    PHASE_COUNT
+} tick_phase_t;
+
+// Log-linear latency histogram: four buckets per power of two nanoseconds
+typedef struct phase_histogram_s {
+    uint32_t buckets[PROF_BUCKETS];
+    uint32_t count;
+    uint64_t max_ns;
+} phase_histogram_t;
+
+typedef struct tick_profiler_s {
+    bool enabled;
+    char *trace_path;
+    FILE *trace;
+    uint64_t origin_ns;
+    uint64_t tick_start_ns;
+    uint64_t phase_ns[PHASE_COUNT];
+    phase_histogram_t histograms[PHASE_COUNT];
+    uint32_t window_overruns;
+    uint64_t total_overruns;
+    uint64_t worst_tick_ns;
+} tick_profiler_t;
+
+// Input-to-photon probes (-L): one CSV line per jetpack change as it goes
+// through the tick, matched against the client probes by jetpack_latency
+typedef struct latency_probe_s {
+    char *path;
+    FILE *file;
+    uint64_t arrival_ns; // Kernel receive time of the last header read
+    uint8_t input[MAX_PLAYERS];
+    bool pending_step[MAX_PLAYERS];
+} latency_probe_t;
+
+typedef enum metrics_direction_e {
+    METRICS_RX,
+    METRICS_TX
+} metrics_direction_t;
+
+// Counters shared with the metrics thread; the game loop only does relaxed
+// atomic adds and stores, the scrape only loads
+typedef struct metrics_s {
+    atomic_uint_fast64_t packets[2][METRICS_MAX_TYPES];
+    atomic_uint_fast64_t bytes[2][METRICS_MAX_TYPES];
+    atomic_uint_fast64_t tick_buckets[METRICS_TICK_BUCKETS];
+    atomic_uint_fast64_t tick_count;
+    atomic_uint_fast64_t tick_sum_ns;
+    atomic_uint_fast64_t matches_started;
+    atomic_int match_running;
+    atomic_int client_fds[METRICS_MAX_FDS]; // fd + 1, 0 when free
+    atomic_uint_fast64_t allocs;
+    atomic_uint_fast64_t frees;
+    atomic_uint_fast64_t alloc_bytes;
+} metrics_t;
+
+// Scrape-side state used to turn the tick counter into a rate
+typedef struct metrics_scrape_s {
+    uint64_t last_ticks;
+    uint64_t last_ns;
+} metrics_scrape_t;
+
 typedef struct server_s {
     int port;
     char *map_path;
-    char **map;
-    size_t map_rows;
-    size_t map_cols;
-    uint16_t start_x;
-    uint16_t start_y;
+    sim_map_t map; // As loaded, copied into sim.map for every match
+    sim_t sim;
     uint8_t message_type;
     int fd;
     struct sockaddr_in addr;
@@ -69,29 +169,49 @@ typedef struct server_s {
     char buffer[1024];
     ssize_t bytes_read;
     client_t **client;
+    slab_pool_t client_pool; // max_clients slots, reused by every match
+    arena_t tick_arena; // Packets of one tick (or one lobby poll)
+    arena_t match_arena; // Map chunks and replay header of one match
+    uint8_t *map_chunks; // Built once per match, sent to every client
     int client_count;
-    bool debug_mode;
+    int max_clients;
+    int match_limit; // Matches served before exiting, 0 for no limit
+    int match_index; // Current match, from 0
+    bool lobby_full;
+    atomic_bool debug_mode; // Toggled by the admin socket mid-tick
     uint32_t tick;
+    tick_profiler_t profiler;
+    latency_probe_t probe;
+    int metrics_port;
+    char *admin_path;
+    int admin_fd;
+    char *replay_path;
+    replay_writer_t *replay;
+    pthread_mutex_t state_lock;
+    atomic_uint tick_us;
+    atomic_uint state_interval;
 } server_t;
 
 // Error handling functions
 void handle_error(char *msg, server_t *server);
 int arg_missing(int argc);
 int check_args(int argc, char **argv);
+int option_arity(const char *option);
+int check_options(int argc, char **argv);
 bool check_port(char *port);
 bool check_path_map(char *path);
 bool check_header(unsigned char header[4], int i, server_t *server);
 int check_payload_length(uint16_t payload_length, server_t *server, int i);
-int check_read(int read_ret, char *payload);
+int check_read(int read_ret);
 
 // Sending messages to clients
 void send_welcome(server_t *server, int client_fd, uint8_t assigned_id);
 void send_game_start(server_t *server, int client_fd);
 void send_map(server_t *server, int client_fd);
-void send_game_state(server_t *server, int client_fd);
 void send_game_state_to_all_clients(server_t *server);
 void send_game_end(server_t *server, uint8_t reason, uint8_t winner_id);
 void send_disconnect(server_t *server);
+void send_coin_events(server_t *server);
 
 // Writing messages to clients
 void write_header(uint8_t *buf, uint8_t type, uint16_t total_len);
@@ -100,8 +220,9 @@ void write_map_payload(uint8_t *buffer, uint16_t chunk_index,
 void write_start_payload(uint8_t *buffer, server_t *server);
 void write_state_payload(uint8_t *buffer, server_t *server,
     uint8_t player_count);
-void write_data_state_payload(uint8_t *buffer, client_t *client, size_t offset,
-    int i);
+void write_data_state_payload(uint8_t *buffer, const sim_player_t *player,
+    size_t offset, int i);
+void write_coin_events_payload(uint8_t *buffer, server_t *server);
 
 // Server set up functions
 void server(int argc, char **argv);
@@ -110,39 +231,86 @@ void set_bind(server_t *server);
 void set_listen(server_t *server);
 
 // Handling client functions
+void open_lobby(server_t *server);
 void handle_clients(server_t *server);
 void read_client(server_t *server, int i);
+void read_ready_clients(server_t *server);
+ssize_t read_all(int fd, char *buffer, size_t size);
 void handle_input(server_t *server, int client_id, char *payload);
 
+bool write_all(int fd, const void *buffer, size_t length);
 bool send_with_write(int fd, const void *buffer, size_t length);
 void parsing_launch(int argc, char **argv, server_t *server);
 void load_map(server_t *server);
 void launch_game(server_t *server);
+void serve_matches(server_t *server);
+bool match_reset(server_t *server);
+void match_end(server_t *server);
 void game_loop(server_t *server);
 char *get_type_string_prev(uint8_t type);
 void close_everything(server_t *server);
 
-// Debugging functions
-void print_debug_info_package_received(server_t *server, char *context,
-    uint16_t payload_length);
+// Memory reused across ticks and matches instead of malloc per packet
+bool arena_init(arena_t *arena, size_t size);
+void *arena_alloc(arena_t *arena, size_t size);
+void arena_reset(arena_t *arena);
+void arena_destroy(arena_t *arena);
+bool slab_init(slab_pool_t *pool, size_t slot_size, size_t capacity);
+void *slab_alloc(slab_pool_t *pool);
+void slab_free(slab_pool_t *pool, void *slot);
+void slab_destroy(slab_pool_t *pool);
+
+// Debugging functions (packets go to the async binary log, see common/)
+void open_debug_log(server_t *server);
 void print_debug_info_package_sent(server_t *server,
-    const char *type_name, const unsigned char *packet, size_t packet_size);
-void print_packet_hex(const unsigned char *header,
-    const unsigned char *payload, size_t payload_len);
+    const unsigned char *packet, size_t packet_size);
 void print_debug_info_connection(server_t *server, char *context);
 void print_debug_all(server_t *server, char *context, char *payload,
     unsigned char *header);
 
-// In game functions
-void check_jetpack(client_t *client, server_t *server);
-void check_limits(client_t *client);
-void check_entities_collisions(client_t *client, server_t *server);
-bool initialize_alive_tracking(server_t *server, int *alive_count,
-    uint8_t *alive_player_id);
-void process_client_state(client_t *client, server_t *server);
-bool is_in_bounds(server_t *server, size_t row, size_t col);
-void handle_coin(client_t *client, server_t *server, size_t row, size_t col);
-void handle_doin(client_t *client, server_t *server, size_t row, size_t col);
-void handle_electic(client_t *client);
+// Tick profiling (-P summaries, -t Chrome trace)
+uint64_t prof_now(void);
+uint64_t prof_record(server_t *server, tick_phase_t phase, uint64_t start);
+void prof_begin_tick(server_t *server);
+void prof_end_tick(server_t *server);
+uint64_t histogram_percentile(const phase_histogram_t *histogram,
+    double quantile);
+void prof_print_summary(server_t *server);
+void prof_open(server_t *server);
+void trace_write_event(server_t *server, tick_phase_t phase, uint64_t start,
+    uint64_t duration);
+void prof_close(server_t *server);
+
+// Prometheus metrics endpoint (-M)
+metrics_t *metrics_get(void);
+void metrics_count_packet(metrics_direction_t direction, uint8_t type,
+    size_t bytes);
+void metrics_observe_tick(uint64_t duration_ns);
+void metrics_track_fd(int fd, bool open);
+void metrics_set_match(bool running);
+void metrics_format(FILE *out, metrics_scrape_t *scrape);
+void metrics_format_process(FILE *out);
+void metrics_start(server_t *server);
+
+// Admin control socket (-a), commands run under state_lock
+void admin_start(server_t *server);
+void admin_execute(server_t *server, char *line, FILE *out);
+void admin_dump_clients(server_t *server, char *arg, FILE *out);
+void admin_dump_stats(server_t *server, char *arg, FILE *out);
+void admin_snapshot(server_t *server, char *arg, FILE *out);
+
+// Match recording (-r), see common/includes/replay_format.h
+void replay_start(server_t *server);
+void replay_capture(server_t *server);
+
+// Latency probes (-L), CLOCK_MONOTONIC like the client ones
+void probe_open(server_t *server);
+void probe_watch(server_t *server, int fd);
+ssize_t probe_read_header(server_t *server, int fd, unsigned char *header);
+void probe_log(server_t *server, const char *event, int player,
+    uint64_t time_ns);
+void probe_close(server_t *server);
+void probe_input(server_t *server, int player, uint8_t jetpack);
+void probe_step(server_t *server);
 
 #endif /* !SERVER_H_ */
@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Input-to-photon probe log
+*/
+
+#include "includes/server.h"
+
+void probe_open(server_t *server)
+{
+    latency_probe_t *probe = &server->probe;
+
+    probe->file = NULL;
+    memset(probe->input, 0, sizeof(probe->input));
+    memset(probe->pending_step, 0, sizeof(probe->pending_step));
+    if (probe->path == NULL)
+        return;
+    probe->file = fopen(probe->path, "w");
+    if (probe->file == NULL) {
+        perror("fopen probe");
+        return;
+    }
+    fprintf(probe->file, "event,player,value,tick,time_ns\n");
+}
+
+// Kernel receive timestamps of the client packets, read by recvmsg()
+void probe_watch(server_t *server, int fd)
+{
+    int enable = 1;
+
+    if (server->probe.file == NULL)
+        return;
+    if (setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &enable,
+        sizeof(enable)) == -1)
+        perror("setsockopt SO_TIMESTAMPNS");
+}
+
+void probe_log(server_t *server, const char *event, int player,
+    uint64_t time_ns)
+{
+    latency_probe_t *probe = &server->probe;
+
+    fprintf(probe->file, "%s,%d,%u,%u,%llu\n", event, player,
+        probe->input[player], server->tick, (unsigned long long)time_ns);
+}
+
+void probe_close(server_t *server)
+{
+    if (server->probe.file == NULL)
+        return;
+    fclose(server->probe.file);
+    server->probe.file = NULL;
+}
@@ -0,0 +1,41 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Jetpack changes followed from the socket to the simulation
+*/
+
+#include "includes/server.h"
+
+void probe_input(server_t *server, int player, uint8_t jetpack)
+{
+    latency_probe_t *probe = &server->probe;
+
+    if (probe->file == NULL || player < 0 || player >= MAX_PLAYERS ||
+        probe->input[player] == jetpack)
+        return;
+    probe->input[player] = jetpack;
+    probe_log(server, "input_arrival", player, probe->arrival_ns);
+    probe_log(server, "input_read", player, prof_now());
+    probe->pending_step[player] = true;
+}
+
+// After sim_step(): the GAME_STATE of this tick shows the changes read
+void probe_step(server_t *server)
+{
+    latency_probe_t *probe = &server->probe;
+    uint64_t now = prof_now();
+    bool logged = false;
+
+    if (probe->file == NULL)
+        return;
+    for (int i = 0; i < server->client_count; i++) {
+        if (!probe->pending_step[i])
+            continue;
+        probe_log(server, "step", i, now);
+        probe->pending_step[i] = false;
+        logged = true;
+    }
+    if (logged)
+        fflush(probe->file);
+}
@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Packet header reads that keep the kernel receive time
+*/
+
+#include "includes/server.h"
+
+// SO_TIMESTAMPNS stamps are CLOCK_REALTIME, the probes CLOCK_MONOTONIC
+static uint64_t arrival_ns(struct msghdr *msg)
+{
+    uint64_t now = prof_now();
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(msg);
+    struct timespec stamp;
+    struct timespec real;
+    int64_t age;
+
+    for (; cmsg != NULL; cmsg = CMSG_NXTHDR(msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET ||
+            cmsg->cmsg_type != SCM_TIMESTAMPNS)
+            continue;
+        memcpy(&stamp, CMSG_DATA(cmsg), sizeof(stamp));
+        clock_gettime(CLOCK_REALTIME, &real);
+        age = (int64_t)(real.tv_sec - stamp.tv_sec) * 1000000000LL +
+            (real.tv_nsec - stamp.tv_nsec);
+        return age > 0 && (uint64_t)age < now ? now - age : now;
+    }
+    return now;
+}
+
+ssize_t probe_read_header(server_t *server, int fd, unsigned char *header)
+{
+    char control[CMSG_SPACE(sizeof(struct timespec))];
+    struct iovec iov = {header, 4};
+    struct msghdr msg = {0};
+    ssize_t received;
+
+    if (server->probe.file == NULL)
+        return read_all(fd, (char *)header, 4);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    received = recvmsg(fd, &msg, MSG_WAITALL);
+    if (received == 0)
+        metrics_track_fd(fd, false);
+    if (received <= 0)
+        return received;
+    server->probe.arrival_ns = arrival_ns(&msg);
+    if (received < 4)
+        return read_all(fd, (char *)header + received, 4 - received);
+    return received;
+}
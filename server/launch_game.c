@@ -9,6 +9,8 @@
 
 void launch_game(server_t *server)
 {
+    metrics_set_match(true);
+    replay_start(server);
     for (int i = 0; i < server->client_count; i++) {
         send_map(server, server->client[i]->fd);
         send_game_start(server, server->client[i]->fd);
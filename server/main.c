@@ -9,7 +9,24 @@
 
 void display_help(void)
 {
-    printf("USAGE: ./jetpack_server -p <port> -m <map> [-d]\n");
+    printf("USAGE: ./jetpack_server -p <port> -m <map> [-d] [-P] "
+        "[-t <trace.json>] [-M <port>]"
+        " [-a <socket>] [-n <players>] [-r <replay>] [-L <probe.csv>]"
+        " [-c <matches>]\n");
+    printf("  -d    record protocol packets to the debug log\n");
+    printf("  -P    print per-phase tick timings every %d ticks\n",
+        PROF_SUMMARY_TICKS);
+    printf("  -t    write tick phases as Chrome trace JSON (implies -P)\n");
+    printf("  -M    serve Prometheus metrics on 127.0.0.1:<port>\n");
+    printf("  -n    players per match, 1-%d (default %d)\n", MAX_PLAYERS,
+        DEFAULT_MAX_CLIENTS);
+    printf("  -a    accept admin commands on a Unix socket ('help')\n");
+    printf("  -r    record the match to a replay file, <replay>.1, "
+        "<replay>.2... when -c is not 1\n");
+    printf("  -L    log input-to-photon probes as CSV (see jetpack_latency)"
+        "\n");
+    printf("  -c    matches played back to back before exiting, 0 for no "
+        "limit (default 1)\n");
 }
 
 int main(int argc, char **argv)
@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Back-to-back matches (-c): lobby, game, teardown
+*/
+
+#include "includes/server.h"
+
+// Allocated once, every match reuses them
+void open_lobby(server_t *server)
+{
+    server->client = calloc(server->max_clients, sizeof(client_t *));
+    server->fds = malloc(sizeof(struct pollfd) * (server->max_clients + 1));
+    if (server->client == NULL || server->fds == NULL ||
+        !slab_init(&server->client_pool, sizeof(client_t),
+        server->max_clients) ||
+        !arena_init(&server->tick_arena, ARENA_TICK_SIZE) ||
+        !arena_init(&server->match_arena, ARENA_MATCH_SIZE))
+        handle_error("malloc", server);
+    server->fds[0].fd = server->fd;
+    server->fds[0].events = POLLIN;
+}
+
+// Fresh players and coins; the rows of sim.map are reused, not reallocated
+bool match_reset(server_t *server)
+{
+    sim_map_t rows = server->sim.map;
+    bool copied;
+
+    pthread_mutex_lock(&server->state_lock);
+    sim_init(&server->sim);
+    server->sim.map = rows;
+    copied = sim_map_copy(&server->sim.map, &server->map);
+    arena_reset(&server->match_arena);
+    server->map_chunks = NULL;
+    server->tick = 0;
+    server->client_count = 0;
+    server->nfds = 1;
+    server->lobby_full = false;
+    pthread_mutex_unlock(&server->state_lock);
+    return copied;
+}
+
+// GAME_END is still queued: FIN after it, and drain what the client sent
+// so close() does not answer with a RST that could drop it
+static void close_client(server_t *server, client_t *client)
+{
+    char discard[256];
+
+    metrics_track_fd(client->fd, false);
+    shutdown(client->fd, SHUT_WR);
+    while (recv(client->fd, discard, sizeof(discard), MSG_DONTWAIT) > 0)
+        continue;
+    close(client->fd);
+    free(client->user);
+    slab_free(&server->client_pool, client);
+}
+
+void match_end(server_t *server)
+{
+    pthread_mutex_lock(&server->state_lock);
+    metrics_set_match(false);
+    if (replay_writer_dropped(server->replay) > 0)
+        fprintf(stderr, "Replay: %u ticks dropped on a full ring\n",
+            replay_writer_dropped(server->replay));
+    replay_writer_close(server->replay);
+    server->replay = NULL;
+    for (int i = 0; i < server->client_count; i++) {
+        close_client(server, server->client[i]);
+        server->client[i] = NULL;
+    }
+    server->client_count = 0;
+    pthread_mutex_unlock(&server->state_lock);
+}
+
+void serve_matches(server_t *server)
+{
+    for (int match = 0; server->match_limit == 0 ||
+        match < server->match_limit; match++) {
+        server->match_index = match;
+        if (!match_reset(server))
+            handle_error("match_reset", server);
+        handle_clients(server);
+        launch_game(server);
+        match_end(server);
+    }
+}
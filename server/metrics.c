@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Lock-free counters exported by the metrics endpoint
+*/
+
+#include "includes/server.h"
+
+metrics_t *metrics_get(void)
+{
+    static metrics_t metrics;
+
+    return &metrics;
+}
+
+void metrics_count_packet(metrics_direction_t direction, uint8_t type,
+    size_t bytes)
+{
+    metrics_t *metrics = metrics_get();
+
+    if (type >= METRICS_MAX_TYPES)
+        type = 0;
+    atomic_fetch_add_explicit(&metrics->packets[direction][type], 1,
+        memory_order_relaxed);
+    atomic_fetch_add_explicit(&metrics->bytes[direction][type], bytes,
+        memory_order_relaxed);
+}
+
+void metrics_observe_tick(uint64_t duration_ns)
+{
+    static const uint64_t bounds_ns[METRICS_TICK_BUCKETS - 1] = {
+        500000, 1000000, 2500000, 5000000, 10000000, 25000000, 50000000,
+        100000000, 250000000
+    };
+    metrics_t *metrics = metrics_get();
+    int bucket = 0;
+
+    while (bucket < METRICS_TICK_BUCKETS - 1 && duration_ns > bounds_ns[bucket])
+        bucket++;
+    atomic_fetch_add_explicit(&metrics->tick_buckets[bucket], 1,
+        memory_order_relaxed);
+    atomic_fetch_add_explicit(&metrics->tick_sum_ns, duration_ns,
+        memory_order_relaxed);
+    atomic_fetch_add_explicit(&metrics->tick_count, 1, memory_order_relaxed);
+}
+
+void metrics_track_fd(int fd, bool open)
+{
+    metrics_t *metrics = metrics_get();
+    int expected;
+
+    for (int i = 0; i < METRICS_MAX_FDS; i++) {
+        expected = open ? 0 : fd + 1;
+        if (atomic_compare_exchange_strong(&metrics->client_fds[i], &expected,
+            open ? fd + 1 : 0))
+            return;
+    }
+}
+
+void metrics_set_match(bool running)
+{
+    metrics_t *metrics = metrics_get();
+
+    if (running)
+        atomic_fetch_add(&metrics->matches_started, 1);
+    atomic_store(&metrics->match_running, running);
+}
@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Prometheus text exposition of the server metrics
+*/
+
+#include "includes/server.h"
+#include <linux/sockios.h>
+#include <sys/ioctl.h>
+
+static void format_traffic(FILE *out, metrics_t *metrics)
+{
+    static const char *directions[2] = {"rx", "tx"};
+    uint64_t packets;
+
+    fprintf(out, "# TYPE jetpack_packets_total counter\n"
+        "# TYPE jetpack_packet_bytes_total counter\n");
+    for (int dir = 0; dir < 2; dir++) {
+        for (int type = 0; type < METRICS_MAX_TYPES; type++) {
+            packets = atomic_load(&metrics->packets[dir][type]);
+            if (packets == 0)
+                continue;
+            fprintf(out, "jetpack_packets_total{direction=\"%s\",type=\"%s\"}"
+                " %llu\n", directions[dir], get_type_string_prev(type),
+                (unsigned long long)packets);
+            fprintf(out, "jetpack_packet_bytes_total{direction=\"%s\","
+                "type=\"%s\"} %llu\n", directions[dir],
+                get_type_string_prev(type), (unsigned long long)
+                atomic_load(&metrics->bytes[dir][type]));
+        }
+    }
+}
+
+static void format_tick_histogram(FILE *out, metrics_t *metrics)
+{
+    static const char *bounds[METRICS_TICK_BUCKETS] = {
+        "0.0005", "0.001", "0.0025", "0.005", "0.01", "0.025", "0.05",
+        "0.1", "0.25", "+Inf"
+    };
+    uint64_t cumulative = 0;
+
+    fprintf(out, "# TYPE jetpack_tick_duration_seconds histogram\n");
+    for (int i = 0; i < METRICS_TICK_BUCKETS; i++) {
+        cumulative += atomic_load(&metrics->tick_buckets[i]);
+        fprintf(out, "jetpack_tick_duration_seconds_bucket{le=\"%s\"} %llu\n",
+            bounds[i], (unsigned long long)cumulative);
+    }
+    fprintf(out, "jetpack_tick_duration_seconds_sum %.6f\n"
+        "jetpack_tick_duration_seconds_count %llu\n",
+        atomic_load(&metrics->tick_sum_ns) / 1e9, (unsigned long long)
+        cumulative);
+}
+
+static void format_clients(FILE *out, metrics_t *metrics)
+{
+    int connected = 0;
+    int fd;
+    int pending;
+
+    fprintf(out, "# TYPE jetpack_send_queue_bytes gauge\n");
+    for (int i = 0; i < METRICS_MAX_FDS; i++) {
+        fd = atomic_load(&metrics->client_fds[i]) - 1;
+        if (fd < 0)
+            continue;
+        connected++;
+        if (ioctl(fd, SIOCOUTQ, &pending) == 0)
+            fprintf(out, "jetpack_send_queue_bytes{fd=\"%d\"} %d\n",
+                fd, pending);
+    }
+    fprintf(out, "# TYPE jetpack_connected_clients gauge\n"
+        "jetpack_connected_clients %d\n", connected);
+}
+
+static void format_allocations(FILE *out, metrics_t *metrics)
+{
+    fprintf(out, "# TYPE jetpack_allocations_total counter\n"
+        "jetpack_allocations_total %llu\n# TYPE jetpack_frees_total counter\n"
+        "jetpack_frees_total %llu\n# TYPE jetpack_allocated_bytes_total "
+        "counter\njetpack_allocated_bytes_total %llu\n",
+        (unsigned long long)atomic_load(&metrics->allocs),
+        (unsigned long long)atomic_load(&metrics->frees),
+        (unsigned long long)atomic_load(&metrics->alloc_bytes));
+}
+
+void metrics_format(FILE *out, metrics_scrape_t *scrape)
+{
+    metrics_t *metrics = metrics_get();
+    uint64_t ticks = atomic_load(&metrics->tick_count);
+    uint64_t now = prof_now();
+    double elapsed = (now - scrape->last_ns) / 1e9;
+
+    format_clients(out, metrics);
+    fprintf(out, "# TYPE jetpack_matches_started_total counter\n"
+        "jetpack_matches_started_total %llu\n# TYPE jetpack_match_running "
+        "gauge\njetpack_match_running %d\n", (unsigned long long)
+        atomic_load(&metrics->matches_started),
+        atomic_load(&metrics->match_running));
+    fprintf(out, "# TYPE jetpack_tick_rate_hz gauge\njetpack_tick_rate_hz "
+        "%.2f\n", scrape->last_ns && elapsed > 0 ?
+        (ticks - scrape->last_ticks) / elapsed : 0.0);
+    scrape->last_ticks = ticks;
+    scrape->last_ns = now;
+    format_tick_histogram(out, metrics);
+    format_traffic(out, metrics);
+    format_allocations(out, metrics);
+    metrics_format_process(out);
+}
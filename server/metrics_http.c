@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Local HTTP listener serving the metrics, off the tick thread
+*/
+
+#include "includes/server.h"
+#include <pthread.h>
+
+static int open_metrics_socket(int port)
+{
+    struct sockaddr_in addr = {0};
+    int opt = 1;
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (fd == -1)
+        return -1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1 ||
+        listen(fd, 8) == -1) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void serve_scrape(int fd, metrics_scrape_t *scrape)
+{
+    char request[1024];
+    char *body = NULL;
+    size_t body_size = 0;
+    FILE *out = open_memstream(&body, &body_size);
+    char header[160];
+    int header_len;
+
+    if (out == NULL)
+        return;
+    // Allocated inside libc where --wrap does not count it, unlike the free
+    atomic_fetch_add_explicit(&metrics_get()->allocs, 1, memory_order_relaxed);
+    if (read(fd, request, sizeof(request)) >= 0)
+        metrics_format(out, scrape);
+    fclose(out);
+    header_len = snprintf(header, sizeof(header), "HTTP/1.0 200 OK\r\n"
+        "Content-Type: text/plain; version=0.0.4\r\n"
+        "Content-Length: %zu\r\n\r\n", body_size);
+    write_all(fd, header, header_len);
+    write_all(fd, body, body_size);
+    free(body);
+}
+
+static void *metrics_thread(void *arg)
+{
+    int listen_fd = (int)(intptr_t)arg;
+    metrics_scrape_t scrape = {0, 0};
+    int fd;
+
+    while (1) {
+        fd = accept(listen_fd, NULL, NULL);
+        if (fd == -1)
+            continue;
+        serve_scrape(fd, &scrape);
+        close(fd);
+    }
+    return NULL;
+}
+
+void metrics_start(server_t *server)
+{
+    pthread_t thread;
+    int fd;
+
+    if (server->metrics_port <= 0)
+        return;
+    fd = open_metrics_socket(server->metrics_port);
+    if (fd == -1) {
+        perror("metrics endpoint");
+        return;
+    }
+    if (pthread_create(&thread, NULL, metrics_thread,
+        (void *)(intptr_t)fd) != 0) {
+        perror("pthread_create metrics");
+        close(fd);
+        return;
+    }
+    pthread_detach(thread);
+    printf("Metrics served on http://127.0.0.1:%d/metrics\n",
+        server->metrics_port);
+}
@@ -0,0 +1,47 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Process resource gauges for leak tracking (RSS, open fds)
+*/
+
+#include "includes/server.h"
+#include <dirent.h>
+
+static long resident_bytes(void)
+{
+    FILE *statm = fopen("/proc/self/statm", "r");
+    long pages = 0;
+    long resident = 0;
+
+    if (statm == NULL)
+        return 0;
+    if (fscanf(statm, "%ld %ld", &pages, &resident) != 2)
+        resident = 0;
+    fclose(statm);
+    return resident * sysconf(_SC_PAGESIZE);
+}
+
+// The directory stream itself holds one of the listed descriptors
+static int open_fds(void)
+{
+    DIR *dir = opendir("/proc/self/fd");
+    struct dirent *entry;
+    int count = 0;
+
+    if (dir == NULL)
+        return 0;
+    for (entry = readdir(dir); entry != NULL; entry = readdir(dir)) {
+        if (entry->d_name[0] != '.')
+            count++;
+    }
+    closedir(dir);
+    return count - 1;
+}
+
+void metrics_format_process(FILE *out)
+{
+    fprintf(out, "# TYPE process_resident_memory_bytes gauge\n"
+        "process_resident_memory_bytes %ld\n# TYPE process_open_fds gauge\n"
+        "process_open_fds %d\n", resident_bytes(), open_fds());
+}
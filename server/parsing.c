@@ -7,17 +7,49 @@
 
 #include "includes/server.h"
 
-void parsing_launch(int argc, char **argv, server_t *server)
+static int parse_option(server_t *server, char **argv, int i)
 {
-    if (argc == 6 && strcmp(argv[5], "-d") == 0) {
+    if (strcmp(argv[i], "-d") == 0)
         server->debug_mode = true;
-        printf("Debug mode enabled - ");
-        printf("verbose protocol logging will be displayed\n");
-        printf("Debug logging initialized\n");
-    } else
-        server->debug_mode = false;
+    if (strcmp(argv[i], "-P") == 0)
+        server->profiler.enabled = true;
+    if (strcmp(argv[i], "-t") == 0)
+        server->profiler.trace_path = argv[i + 1];
+    if (strcmp(argv[i], "-M") == 0)
+        server->metrics_port = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-a") == 0)
+        server->admin_path = argv[i + 1];
+    if (strcmp(argv[i], "-n") == 0)
+        server->max_clients = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-r") == 0)
+        server->replay_path = argv[i + 1];
+    if (strcmp(argv[i], "-L") == 0)
+        server->probe.path = argv[i + 1];
+    if (strcmp(argv[i], "-c") == 0)
+        server->match_limit = atoi(argv[i + 1]);
+    return i + 1 + option_arity(argv[i]);
+}
+
+void parsing_launch(int argc, char **argv, server_t *server)
+{
+    server->debug_mode = false;
+    server->metrics_port = 0;
+    server->admin_path = NULL;
+    server->replay_path = NULL;
+    server->probe.path = NULL;
+    server->max_clients = DEFAULT_MAX_CLIENTS;
+    server->match_limit = 1;
+    server->match_index = 0;
+    for (int i = 5; i < argc;)
+        i = parse_option(server, argv, i);
     server->port = atoi(argv[2]);
     server->map_path = argv[4];
-    if (server->debug_mode)
+    if (server->debug_mode) {
+        printf("Debug mode enabled - ");
+        printf("verbose protocol logging will be recorded\n");
+        open_debug_log(server);
         print_debug_info_connection(server, "Main");
+    }
+    prof_open(server);
+    probe_open(server);
 }
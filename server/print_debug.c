@@ -6,17 +6,25 @@
 */
 
 #include "includes/server.h"
+#include "binlog.h"
+#include <sys/stat.h>
 #include <time.h>
 
-void print_packet_hex(const unsigned char *header,
-    const unsigned char *payload, size_t payload_len)
+void open_debug_log(server_t *server)
 {
-    printf("Payload: ");
-    for (int i = 0; i < 4; i++)
-        printf("%02x ", header[i]);
-    for (size_t i = 0; i < payload_len; i++)
-        printf("%02x%s", payload[i], i == payload_len - 1 ? "" : " ");
-    printf("\n\n");
+    time_t now = time(NULL);
+    char path[64];
+
+    if (!server->debug_mode)
+        return;
+    mkdir("debug", 0755);
+    strftime(path, sizeof(path), "debug/server_%Y-%m-%d_%H-%M-%S.jlog",
+        localtime(&now));
+    if (binlog_open(path))
+        printf("Debug log written to: %s (decode with jetpack_logdump)\n",
+            path);
+    else
+        fprintf(stderr, "Warning: Failed to open debug log %s\n", path);
 }
 
 void print_debug_info_connection(server_t *server, char *context)
@@ -32,44 +40,24 @@ void print_debug_info_connection(server_t *server, char *context)
         time_buf, context, server->port);
 }
 
-void print_debug_info_package_received(server_t *server, char *context,
-    uint16_t payload_length)
-{
-    time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
-    char time_buf[9];
-    char *type = NULL;
-
-    strftime(time_buf, sizeof(time_buf), "%H:%M:%S", tm_info);
-    type = get_type_string_prev(server->message_type);
-    printf("[%s][%s] Received packet: type=0x%02X (%s), length=%u bytes\n",
-        time_buf, context, server->message_type, type, payload_length);
-}
-
 void print_debug_info_package_sent(server_t *server,
-    const char *type_name, const unsigned char *packet, size_t packet_size)
+    const unsigned char *packet, size_t packet_size)
 {
-    time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
-    char time_buf[9];
+    binlog_packet_t record = {"Server", BINLOG_TX, packet, 4, packet + 4,
+        packet_size - 4};
 
     if (!server->debug_mode)
         return;
-    strftime(time_buf, sizeof(time_buf), "%H:%M:%S", tm_info);
-    printf("[Server][%s] Sent packet: type=0x%02X (%s), length=%zu bytes\n",
-        time_buf, packet[1], type_name, packet_size);
-    print_packet_hex(packet, packet + 4, packet_size - 4);
+    binlog_packet(&record);
 }
 
 void print_debug_all(server_t *server, char *context, char *payload,
     unsigned char *header)
 {
-    uint16_t payload_length;
+    binlog_packet_t record = {context, BINLOG_RX, header, 4, payload, 0};
 
     if (!server->debug_mode)
         return;
-    payload_length = ntohs(*(uint16_t *)(header + 2));
-    print_debug_info_package_received(server, context, payload_length);
-    print_packet_hex(header, (unsigned char *)payload,
-        payload_length - 4);
+    record.payload_len = ntohs(*(uint16_t *)(header + 2)) - 4;
+    binlog_packet(&record);
 }
@@ -12,8 +12,8 @@ void handle_message(server_t *server, int client_id, char *payload)
     switch (server->message_type) {
         case CLIENT_CONNECT:
             send_welcome(server, server->client[client_id]->fd, client_id);
-            if (server->client_count == MAX_CLIENTS)
-                launch_game(server);
+            if (server->client_count == server->max_clients)
+                server->lobby_full = true;
             break;
         case GAME_INPUT:
             handle_input(server, client_id, payload);
@@ -33,6 +33,8 @@ ssize_t read_all(int fd, char *buffer, size_t size)
 
     while (total_read < size) {
         bytes_read = read(fd, buffer + total_read, size - total_read);
+        if (bytes_read == 0)
+            metrics_track_fd(fd, false);
         if (bytes_read <= 0)
             return bytes_read;
         total_read += bytes_read;
@@ -47,19 +49,31 @@ void read_client(server_t *server, int i)
     uint16_t payload_length;
     char *payload;
 
-    read_ret = read_all(server->client[i]->fd, (char *)header, 4);
+    read_ret = probe_read_header(server, server->client[i]->fd, header);
     if (read_ret <= 0 || !check_header((unsigned char *)header, i, server))
         return;
     payload_length = ntohs(*(uint16_t *)(header + 2));
     if (check_payload_length(payload_length, server, i) == 84)
         return;
-    payload = malloc((payload_length - 4) * sizeof(char));
+    payload = arena_alloc(&server->tick_arena, payload_length - 4);
     if (!payload)
-        handle_error("malloc", server);
+        handle_error("arena_alloc", server);
     read_ret = read_all(server->client[i]->fd, payload, payload_length - 4);
-    if (check_read(read_ret, payload) == 84)
+    if (check_read(read_ret) == 84)
         return;
     print_debug_all(server, "Server", payload, header);
     handle_message(server, i, payload);
-    free(payload);
+}
+
+// Input already received; a silent client no longer holds up the tick
+void read_ready_clients(server_t *server)
+{
+    struct pollfd pfd = {.events = POLLIN};
+
+    for (int i = 0; i < server->client_count; i++) {
+        pfd.fd = server->client[i]->fd;
+        for (int n = 0; n < READ_BURST && poll(&pfd, 1, 0) > 0 &&
+            (pfd.revents & POLLIN); n++)
+            read_client(server, i);
+    }
 }
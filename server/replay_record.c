@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Match recording (-r), the file itself is written off the tick thread
+*/
+
+#include "includes/server.h"
+#include <limits.h>
+
+static uint8_t *flatten_map(server_t *server, const sim_map_t *map)
+{
+    uint8_t *flat = arena_alloc(&server->match_arena,
+        map->row_count * map->col_count);
+
+    if (flat == NULL)
+        return NULL;
+    for (size_t row = 0; row < map->row_count; row++)
+        memcpy(flat + row * map->col_count, map->rows[row], map->col_count);
+    return flat;
+}
+
+// -c other than 1 records each match to <replay>.<match>, counted from 1
+void replay_start(server_t *server)
+{
+    const sim_t *sim = &server->sim;
+    replay_file_header_t header = {.player_count = sim->player_count,
+        .map_rows = sim->map.row_count, .map_cols = sim->map.col_count,
+        .start_x = sim->start_x, .start_y = sim->start_y,
+        .tick_us = atomic_load(&server->tick_us)};
+    char path[PATH_MAX];
+    uint8_t *map;
+
+    if (server->replay_path == NULL)
+        return;
+    map = flatten_map(server, &sim->map);
+    if (map == NULL)
+        handle_error("arena_alloc", server);
+    snprintf(path, sizeof(path), server->match_limit == 1 ? "%s" : "%s.%d",
+        server->replay_path, server->match_index + 1);
+    server->replay = replay_writer_open(path, &header, map);
+    if (server->replay == NULL)
+        fprintf(stderr, "Cannot record the match to %s\n", path);
+}
+
+static void fill_players(replay_columns_t *columns, const sim_t *sim)
+{
+    const sim_player_t *player;
+
+    for (int i = 0; i < sim->player_count; i++) {
+        player = &sim->players[i];
+        columns->values[REPLAY_X][i] = player->x;
+        columns->values[REPLAY_Y][i] = player->y;
+        columns->values[REPLAY_SCORE][i] = (uint32_t)player->score;
+        columns->values[REPLAY_FLAGS][i] =
+            (player->alive ? REPLAY_PLAYER_ALIVE : 0) |
+            (player->jetpack ? REPLAY_PLAYER_JETPACK : 0) |
+            (player->collected_coin ? REPLAY_PLAYER_COIN : 0);
+    }
+}
+
+static void fill_tick(replay_tick_t *tick, const sim_t *sim)
+{
+    tick->tick = sim->tick;
+    tick->status = sim->status == SIM_ENDED ? REPLAY_ENDED : REPLAY_RUNNING;
+    tick->winner = sim->winner;
+    fill_players(&tick->players, sim);
+    tick->coin_count = sim->coin_event_count;
+    for (int i = 0; i < sim->coin_event_count; i++) {
+        tick->coins[i].coin_id = sim->coin_events[i].coin_id;
+        tick->coins[i].collector = sim->coin_events[i].collector;
+    }
+}
+
+// Never waits on the disk: a full ring drops the tick, and the final one
+// is written when match_end closes the file, after the tick loop
+void replay_capture(server_t *server)
+{
+    if (server->replay == NULL)
+        return;
+    fill_tick(replay_writer_slot(server->replay), &server->sim);
+    replay_writer_commit(server->replay);
+}
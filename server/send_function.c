@@ -8,7 +8,8 @@
 #include "includes/server.h"
 #include <unistd.h>
 
-bool send_with_write(int fd, const void *buffer, size_t length)
+// Plain write loop, no packet accounting (metrics endpoint)
+bool write_all(int fd, const void *buffer, size_t length)
 {
     const char *buf = (const char *)buffer;
     size_t total_written = 0;
@@ -24,3 +25,13 @@ bool send_with_write(int fd, const void *buffer, size_t length)
     }
     return true;
 }
+
+// Game packets only: buffer[1] is the packet type counted in the metrics
+bool send_with_write(int fd, const void *buffer, size_t length)
+{
+    if (!write_all(fd, buffer, length))
+        return false;
+    if (length >= 4)
+        metrics_count_packet(METRICS_TX, ((const char *)buffer)[1], length);
+    return true;
+}
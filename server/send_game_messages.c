@@ -16,38 +16,36 @@ void send_game_start(server_t *server, int client_fd)
     write_start_payload(buffer, server);
     if (!send_with_write(client_fd, buffer, sizeof(buffer)))
         perror("send_with_write GAME_START");
-    print_debug_info_package_sent(server, get_type_string_prev(buffer[1]),
-        buffer, sizeof(buffer));
+    print_debug_info_package_sent(server, buffer, sizeof(buffer));
 }
 
-void send_game_state(server_t *server, int client_fd)
+// Same packet for every client: built once, in the tick arena
+static uint8_t *build_game_state(server_t *server, uint16_t total_msg_size)
 {
-    size_t player_data_size = server->client_count * 9;
-    uint16_t total_payload_size = 4 + 1 + player_data_size;
-    uint16_t total_msg_size = 4 + total_payload_size;
-    uint8_t *buffer = malloc(total_msg_size);
-    size_t offset;
+    uint8_t *buffer = arena_alloc(&server->tick_arena, total_msg_size);
+    size_t offset = 9;
 
     if (!buffer)
-        handle_error("malloc", server);
+        handle_error("arena_alloc", server);
     write_header(buffer, GAME_STATE, total_msg_size);
     write_state_payload(buffer, server, server->client_count);
-    offset = 9;
     for (int i = 0; i < server->client_count; i++) {
-        write_data_state_payload(buffer, server->client[i], offset, i);
+        write_data_state_payload(buffer, &server->sim.players[i], offset, i);
         offset += 9;
     }
-    if (!send_with_write(client_fd, buffer, total_msg_size))
-        perror("send_with_write GAME_STATE");
-    print_debug_info_package_sent(server, get_type_string_prev(buffer[1]),
-        buffer, total_msg_size);
-    free(buffer);
+    return buffer;
 }
 
 void send_game_state_to_all_clients(server_t *server)
 {
-    for (int i = 0; i < server->client_count; i++)
-        send_game_state(server, server->client[i]->fd);
+    uint16_t total_msg_size = 4 + 4 + 1 + server->client_count * 9;
+    uint8_t *buffer = build_game_state(server, total_msg_size);
+
+    for (int i = 0; i < server->client_count; i++) {
+        if (!send_with_write(server->client[i]->fd, buffer, total_msg_size))
+            perror("send_with_write GAME_STATE");
+        print_debug_info_package_sent(server, buffer, total_msg_size);
+    }
 }
 
 void send_game_end(server_t *server, uint8_t reason, uint8_t winner_id)
@@ -58,10 +56,10 @@ void send_game_end(server_t *server, uint8_t reason, uint8_t winner_id)
     write_header(buffer, GAME_END, length);
     buffer[4] = reason;
     buffer[5] = winner_id;
+    metrics_set_match(false);
     for (int i = 0; i < server->client_count; i++) {
         if (!send_with_write(server->client[i]->fd, buffer, length))
             perror("send_with_write GAME_END");
-        print_debug_info_package_sent(server, get_type_string_prev(buffer[1]),
-            buffer, length);
+        print_debug_info_package_sent(server, buffer, length);
     }
 }
@@ -17,36 +17,44 @@ void send_welcome(server_t *server, int client_fd, uint8_t assigned_id)
     buffer[5] = assigned_id;
     if (!send_with_write(client_fd, buffer, sizeof(buffer)))
         handle_error("send_with_write SERVER_WELCOME", server);
-    print_debug_info_package_sent(server, get_type_string_prev(buffer[1]),
-        buffer, sizeof(buffer));
+    print_debug_info_package_sent(server, buffer, sizeof(buffer));
 }
 
-void send_map_chunk(server_t *server, int client_fd, uint8_t col_index)
+// Chunk i starts at i * (8 + row_count), in the match arena
+static uint8_t *build_map_chunks(server_t *server)
 {
-    size_t total_size;
+    const sim_map_t *map = &server->sim.map;
+    size_t chunk_size = 4 + (4 + map->row_count);
+    uint8_t *chunks = arena_alloc(&server->match_arena,
+        chunk_size * map->col_count);
     uint8_t *buffer;
 
-    if (col_index >= server->map_cols)
-        return;
-    total_size = 4 + (4 + server->map_rows);
-    buffer = malloc(total_size);
-    if (!buffer)
-        handle_error("malloc", server);
-    write_header(buffer, MAP_CHUNK, 4 + 4 + server->map_rows);
-    write_map_payload(buffer, col_index, (uint16_t)server->map_cols);
-    for (size_t row = 0; row < server->map_rows; row++)
-        buffer[8 + row] = server->map[row][col_index];
-    if (!send_with_write(client_fd, buffer, total_size))
-        handle_error("send_with_write MAP_CHUNK", server);
-    print_debug_info_package_sent(server, get_type_string_prev(buffer[1]),
-        buffer, total_size);
-    free(buffer);
+    if (!chunks)
+        handle_error("arena_alloc", server);
+    for (size_t col = 0; col < map->col_count; col++) {
+        buffer = chunks + col * chunk_size;
+        write_header(buffer, MAP_CHUNK, chunk_size);
+        write_map_payload(buffer, col, (uint16_t)map->col_count);
+        for (size_t row = 0; row < map->row_count; row++)
+            buffer[8 + row] = map->rows[row][col];
+    }
+    return chunks;
 }
 
 void send_map(server_t *server, int client_fd)
 {
-    for (uint8_t col_index = 0; col_index < server->map_cols; col_index++)
-        send_map_chunk(server, client_fd, col_index);
+    size_t col_count = server->sim.map.col_count;
+    size_t chunk_size = 4 + (4 + server->sim.map.row_count);
+    uint8_t *buffer;
+
+    if (server->map_chunks == NULL)
+        server->map_chunks = build_map_chunks(server);
+    for (size_t col = 0; col < col_count; col++) {
+        buffer = server->map_chunks + col * chunk_size;
+        if (!send_with_write(client_fd, buffer, chunk_size))
+            handle_error("send_with_write MAP_CHUNK", server);
+        print_debug_info_package_sent(server, buffer, chunk_size);
+    }
 }
 
 void send_disconnect(server_t *server)
@@ -61,7 +69,6 @@ void send_disconnect(server_t *server)
             continue;
         if (!send_with_write(server->client[i]->fd, buffer, sizeof(buffer)))
             handle_error("send_with_write CLIENT_DISCONNECT", server);
-        print_debug_info_package_sent(server,
-            get_type_string_prev(buffer[1]), buffer, sizeof(buffer));
+        print_debug_info_package_sent(server, buffer, sizeof(buffer));
     }
 }
@@ -6,14 +6,46 @@
 */
 
 #include "includes/server.h"
+#include "binlog.h"
 
 void close_everything(server_t *server)
 {
     for (int i = 0; i < server->client_count; i++) {
         close(server->client[i]->fd);
-        free(server->client[i]);
+        free(server->client[i]->user);
     }
+    free(server->client);
+    free(server->fds);
+    slab_destroy(&server->client_pool);
+    arena_destroy(&server->tick_arena);
+    arena_destroy(&server->match_arena);
+    replay_writer_close(server->replay);
+    sim_map_free(&server->sim.map);
+    sim_map_free(&server->map);
+    prof_close(server);
+    probe_close(server);
+    if (server->admin_path != NULL)
+        unlink(server->admin_path);
     free(server);
+    binlog_close();
+}
+
+static void init_runtime_state(server_t *server)
+{
+    memset(&server->profiler, 0, sizeof(server->profiler));
+    pthread_mutex_init(&server->state_lock, NULL);
+    atomic_init(&server->tick_us, DEFAULT_TICK_US);
+    atomic_init(&server->state_interval, 1);
+    server->client_count = 0;
+    server->client = NULL;
+    server->fds = NULL;
+    memset(&server->client_pool, 0, sizeof(server->client_pool));
+    server->tick_arena.head = NULL;
+    server->match_arena.head = NULL;
+    server->map_chunks = NULL;
+    server->replay = NULL;
+    memset(&server->map, 0, sizeof(server->map));
+    sim_init(&server->sim);
 }
 
 void server(int argc, char **argv)
@@ -22,15 +54,15 @@ void server(int argc, char **argv)
 
     if (server == NULL)
         handle_error("malloc", server);
+    init_runtime_state(server);
     parsing_launch(argc, argv, server);
     server->fd = set_server_socket(server);
-    server->client_count = 0;
-    server->start_x = 1;
-    server->start_y = 1000;
     set_bind(server);
     set_listen(server);
+    metrics_start(server);
+    admin_start(server);
     load_map(server);
-    handle_clients(server);
-    launch_game(server);
+    open_lobby(server);
+    serve_matches(server);
     close_everything(server);
 }
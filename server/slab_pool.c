@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Fixed-size slab pool, every slot allocated up front
+*/
+
+#include "includes/server.h"
+
+bool slab_init(slab_pool_t *pool, size_t slot_size, size_t capacity)
+{
+    pool->slot_size = slot_size;
+    pool->capacity = capacity;
+    pool->slots = calloc(capacity, slot_size);
+    pool->free_slots = malloc(capacity * sizeof(void *));
+    if (pool->slots == NULL || pool->free_slots == NULL)
+        return false;
+    for (size_t i = 0; i < capacity; i++)
+        pool->free_slots[i] = pool->slots + (capacity - 1 - i) * slot_size;
+    pool->free_count = capacity;
+    return true;
+}
+
+// NULL once every slot is taken
+void *slab_alloc(slab_pool_t *pool)
+{
+    if (pool->free_count == 0)
+        return NULL;
+    pool->free_count--;
+    return pool->free_slots[pool->free_count];
+}
+
+void slab_free(slab_pool_t *pool, void *slot)
+{
+    if (slot == NULL || pool->free_count == pool->capacity)
+        return;
+    pool->free_slots[pool->free_count] = slot;
+    pool->free_count++;
+}
+
+void slab_destroy(slab_pool_t *pool)
+{
+    free(pool->slots);
+    free(pool->free_slots);
+    pool->slots = NULL;
+    pool->free_slots = NULL;
+    pool->free_count = 0;
+}
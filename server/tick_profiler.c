@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Per-phase tick timing and overrun accounting
+*/
+
+#include "includes/server.h"
+
+static void histogram_add(phase_histogram_t *histogram, uint64_t ns)
+{
+    int msb;
+    int bucket = (int)ns;
+
+    if (ns >= 4) {
+        msb = 63 - __builtin_clzll(ns);
+        bucket = (msb - 1) * 4 + (int)((ns >> (msb - 2)) & 3);
+    }
+    if (bucket >= PROF_BUCKETS)
+        bucket = PROF_BUCKETS - 1;
+    histogram->buckets[bucket]++;
+    histogram->count++;
+    if (ns > histogram->max_ns)
+        histogram->max_ns = ns;
+}
+
+uint64_t prof_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+uint64_t prof_record(server_t *server, tick_phase_t phase, uint64_t start)
+{
+    uint64_t now = prof_now();
+
+    if (!server->profiler.enabled)
+        return now;
+    server->profiler.phase_ns[phase] += now - start;
+    trace_write_event(server, phase, start, now - start);
+    return now;
+}
+
+void prof_begin_tick(server_t *server)
+{
+    memset(server->profiler.phase_ns, 0, sizeof(server->profiler.phase_ns));
+    server->profiler.tick_start_ns = prof_now();
+}
+
+void prof_end_tick(server_t *server)
+{
+    tick_profiler_t *prof = &server->profiler;
+
+    metrics_observe_tick(prof_now() - prof->tick_start_ns);
+    if (!prof->enabled)
+        return;
+    prof_record(server, PHASE_TICK, prof->tick_start_ns);
+    for (int phase = 0; phase < PHASE_COUNT; phase++)
+        histogram_add(&prof->histograms[phase], prof->phase_ns[phase]);
+    if (prof->phase_ns[PHASE_TICK] > atomic_load(&server->tick_us) * 1000ULL) {
+        prof->window_overruns++;
+        prof->total_overruns++;
+    }
+    if (prof->phase_ns[PHASE_TICK] > prof->worst_tick_ns)
+        prof->worst_tick_ns = prof->phase_ns[PHASE_TICK];
+    if ((server->tick + 1) % PROF_SUMMARY_TICKS == 0)
+        prof_print_summary(server);
+}
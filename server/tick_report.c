@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Periodic tick profiler summary
+*/
+
+#include "includes/server.h"
+
+static const char *phase_name(int phase)
+{
+    static const char *names[PHASE_COUNT] = {
+        "input", "simulate", "game_end", "state", "events", "tick"
+    };
+
+    return names[phase];
+}
+
+static uint64_t bucket_upper_ns(int bucket)
+{
+    int msb;
+    uint64_t low;
+
+    if (bucket < 4)
+        return (uint64_t)bucket;
+    msb = bucket / 4 + 1;
+    low = (uint64_t)(4 + bucket % 4) << (msb - 2);
+    return low + (1ULL << (msb - 2)) - 1;
+}
+
+uint64_t histogram_percentile(const phase_histogram_t *histogram,
+    double quantile)
+{
+    uint64_t target = (uint64_t)(quantile * histogram->count + 0.999999);
+    uint64_t seen = 0;
+    uint64_t upper;
+
+    if (histogram->count == 0)
+        return 0;
+    for (int bucket = 0; bucket < PROF_BUCKETS; bucket++) {
+        seen += histogram->buckets[bucket];
+        if (seen >= target && seen > 0) {
+            upper = bucket_upper_ns(bucket);
+            return upper < histogram->max_ns ? upper : histogram->max_ns;
+        }
+    }
+    return histogram->max_ns;
+}
+
+static void print_phase(const phase_histogram_t *histogram, int phase)
+{
+    printf("  %-9s %9.3f %9.3f %9.3f\n", phase_name(phase),
+        histogram_percentile(histogram, 0.50) / 1e6,
+        histogram_percentile(histogram, 0.99) / 1e6,
+        histogram->max_ns / 1e6);
+}
+
+void prof_print_summary(server_t *server)
+{
+    tick_profiler_t *prof = &server->profiler;
+
+    if (prof->histograms[PHASE_TICK].count == 0)
+        return;
+    printf("[profiler] tick %u: %u ticks, %u over %.1f ms budget "
+        "(%llu total, worst %.3f ms)\n", server->tick + 1,
+        prof->histograms[PHASE_TICK].count, prof->window_overruns,
+        atomic_load(&server->tick_us) / 1e3,
+        (unsigned long long)prof->total_overruns, prof->worst_tick_ns / 1e6);
+    printf("  %-9s %9s %9s %9s\n", "phase", "p50 ms", "p99 ms", "max ms");
+    for (int phase = 0; phase < PHASE_COUNT; phase++)
+        print_phase(&prof->histograms[phase], phase);
+    memset(prof->histograms, 0, sizeof(prof->histograms));
+    prof->window_overruns = 0;
+}
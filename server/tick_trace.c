@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Chrome trace-event output for the tick profiler
+*/
+
+#include "includes/server.h"
+
+static const char *trace_phase_name(tick_phase_t phase)
+{
+    static const char *names[PHASE_COUNT] = {
+        "read_client", "sim_step", "send_game_end",
+        "send_game_state", "send_coin_events", "tick"
+    };
+
+    return names[phase];
+}
+
+void prof_open(server_t *server)
+{
+    tick_profiler_t *prof = &server->profiler;
+
+    prof->origin_ns = prof_now();
+    if (prof->trace_path == NULL)
+        return;
+    prof->trace = fopen(prof->trace_path, "w");
+    if (prof->trace == NULL) {
+        perror("fopen trace");
+        return;
+    }
+    prof->enabled = true;
+    fprintf(prof->trace, "[\n{\"name\":\"thread_name\",\"ph\":\"M\","
+        "\"pid\":1,\"tid\":1,\"args\":{\"name\":\"game_loop\"}}");
+}
+
+void trace_write_event(server_t *server, tick_phase_t phase, uint64_t start,
+    uint64_t duration)
+{
+    tick_profiler_t *prof = &server->profiler;
+    uint64_t ts = start - prof->origin_ns;
+
+    if (prof->trace == NULL)
+        return;
+    fprintf(prof->trace, ",\n{\"name\":\"%s\",\"cat\":\"tick\",\"ph\":\"X\","
+        "\"ts\":%llu.%03llu,\"dur\":%llu.%03llu,\"pid\":1,\"tid\":1,"
+        "\"args\":{\"tick\":%u}}", trace_phase_name(phase),
+        (unsigned long long)(ts / 1000), (unsigned long long)(ts % 1000),
+        (unsigned long long)(duration / 1000),
+        (unsigned long long)(duration % 1000), server->tick);
+    if (phase == PHASE_TICK)
+        fflush(prof->trace);
+}
+
+void prof_close(server_t *server)
+{
+    tick_profiler_t *prof = &server->profiler;
+
+    if (prof->enabled)
+        prof_print_summary(server);
+    if (prof->trace != NULL) {
+        fprintf(prof->trace, "\n]\n");
+        fclose(prof->trace);
+        prof->trace = NULL;
+    }
+}
@@ -27,10 +27,10 @@ void write_map_payload(uint8_t *buffer, uint16_t chunk_index,
 void write_start_payload(uint8_t *buffer, server_t *server)
 {
     buffer[4] = server->client_count;
-    buffer[5] = (server->start_x >> 8) & 0xFF;
-    buffer[6] = server->start_x & 0xFF;
-    buffer[7] = (server->start_y >> 8) & 0xFF;
-    buffer[8] = server->start_y & 0xFF;
+    buffer[5] = (server->sim.start_x >> 8) & 0xFF;
+    buffer[6] = server->sim.start_x & 0xFF;
+    buffer[7] = (server->sim.start_y >> 8) & 0xFF;
+    buffer[8] = server->sim.start_y & 0xFF;
 }
 
 void write_state_payload(uint8_t *buffer, server_t *server,
@@ -43,16 +43,16 @@ void write_state_payload(uint8_t *buffer, server_t *server,
     buffer[8] = player_count;
 }
 
-void write_data_state_payload(uint8_t *buffer, client_t *client, size_t offset,
-    int i)
+void write_data_state_payload(uint8_t *buffer, const sim_player_t *player,
+    size_t offset, int i)
 {
     buffer[offset] = i;
-    buffer[offset + 1] = (client->x >> 8) & 0xFF;
-    buffer[offset + 2] = client->x & 0xFF;
-    buffer[offset + 3] = (client->y >> 8) & 0xFF;
-    buffer[offset + 4] = client->y & 0xFF;
-    buffer[offset + 5] = (client->score >> 8) & 0xFF;
-    buffer[offset + 6] = client->score & 0xFF;
-    buffer[offset + 7] = client->is_alive ? 1 : 0;
-    buffer[offset + 8] = client->collected_coin ? 1 : 0;
+    buffer[offset + 1] = (player->x >> 8) & 0xFF;
+    buffer[offset + 2] = player->x & 0xFF;
+    buffer[offset + 3] = (player->y >> 8) & 0xFF;
+    buffer[offset + 4] = player->y & 0xFF;
+    buffer[offset + 5] = (player->score >> 8) & 0xFF;
+    buffer[offset + 6] = player->score & 0xFF;
+    buffer[offset + 7] = player->alive ? 1 : 0;
+    buffer[offset + 8] = player->collected_coin ? 1 : 0;
 }
@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Socket-free game rules shared by the server and offline tools
+*/
+
+#ifndef SIM_H_
+    #define SIM_H_
+
+    #include <stdbool.h>
+    #include <stddef.h>
+    #include <stdint.h>
+
+    #define SIM_MAX_PLAYERS 255
+    #define SIM_MAX_COIN_EVENTS 256
+    #define SIM_WORLD_SIZE 1000
+    #define SIM_FINISH_X 999
+    #define SIM_START_X 1
+    #define SIM_START_Y 1000
+    #define SIM_NO_WINNER 0xFF
+
+    #ifdef __cplusplus
+extern "C" {
+    #endif
+
+/*
+** Positions live in a 1000x1000 world scaled onto the map grid. One
+** sim_step() moves every player once, in player order, so a run is fully
+** determined by the map and the inputs given to each step.
+*/
+typedef struct sim_map_s {
+    char **rows;
+    size_t row_count;
+    size_t col_count; // Longest line, newline included
+} sim_map_t;
+
+typedef struct sim_player_s {
+    uint16_t x;
+    uint16_t y;
+    int score;
+    bool alive;
+    bool jetpack;
+    bool collected_coin; // Set by the step that collected it
+} sim_player_t;
+
+typedef struct sim_coin_event_s {
+    uint32_t coin_id; // row * col_count + col
+    uint8_t collector;
+} sim_coin_event_t;
+
+typedef enum sim_status_e {
+    SIM_RUNNING,
+    SIM_ENDED
+} sim_status_t;
+
+typedef struct sim_s {
+    sim_map_t map;
+    uint16_t start_x;
+    uint16_t start_y;
+    sim_player_t players[SIM_MAX_PLAYERS];
+    int player_count;
+    uint32_t tick;
+    sim_coin_event_t coin_events[SIM_MAX_COIN_EVENTS]; // Last step only
+    int coin_event_count;
+    sim_status_t status;
+    uint8_t winner;
+} sim_t;
+
+// Maps (rows are mutated as coins are collected)
+bool sim_map_load(sim_map_t *map, const char *path);
+bool sim_map_copy(sim_map_t *dst, const sim_map_t *src);
+void sim_map_free(sim_map_t *map);
+
+// Match state
+void sim_init(sim_t *sim);
+int sim_add_player(sim_t *sim);
+void sim_set_input(sim_t *sim, int player, bool jetpack);
+// Same players back at the start line, on a fresh copy of the map
+bool sim_restart(sim_t *sim, const sim_map_t *map);
+
+// Rules; inputs holds one jetpack flag per player, NULL keeps the last ones
+sim_status_t sim_step(sim_t *sim, const uint8_t *inputs);
+void sim_step_player(sim_t *sim, int index);
+void sim_move_player(const sim_map_t *map, sim_player_t *player);
+char *sim_cell(const sim_map_t *map, const sim_player_t *player,
+    uint32_t *cell_id);
+
+    #ifdef __cplusplus
+}
+    #endif
+
+#endif /* !SIM_H_ */
@@ -0,0 +1,36 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Batch match simulation and map validation tool
+*/
+
+#ifndef SIMULATE_H_
+    #define SIMULATE_H_
+
+    #include "sim.h"
+
+typedef struct simulate_args_s {
+    const char *map_path;
+    int players;
+    int matches;
+    uint32_t max_ticks;
+    uint32_t seed;
+    bool validate;
+} simulate_args_t;
+
+typedef struct batch_result_s {
+    uint64_t ticks;
+    int timeouts;
+    int no_winner;
+    uint64_t total_score;
+    uint64_t violations;
+    uint32_t wins[SIM_MAX_PLAYERS];
+    double seconds;
+} batch_result_t;
+
+int run_batch(const sim_map_t *map, const simulate_args_t *args);
+void print_batch(const simulate_args_t *args, const batch_result_t *result);
+int validate_map(const sim_map_t *map);
+
+#endif /* !SIMULATE_H_ */
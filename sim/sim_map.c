@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Map loading for the simulation
+*/
+
+#include "sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+static void measure_map(FILE *file, size_t *rows, size_t *cols)
+{
+    char *line = NULL;
+    size_t len = 0;
+    ssize_t read;
+
+    *rows = 0;
+    *cols = 0;
+    while ((read = getline(&line, &len, file)) != -1) {
+        (*rows)++;
+        if ((size_t)read > *cols)
+            *cols = read;
+    }
+    free(line);
+}
+
+static bool allocate_rows(sim_map_t *map)
+{
+    map->rows = calloc(map->row_count, sizeof(char *));
+    if (map->rows == NULL)
+        return false;
+    for (size_t i = 0; i < map->row_count; i++) {
+        map->rows[i] = calloc(map->col_count + 1, sizeof(char));
+        if (map->rows[i] == NULL)
+            return false;
+    }
+    return true;
+}
+
+bool sim_map_load(sim_map_t *map, const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char *line = NULL;
+    size_t len = 0;
+
+    memset(map, 0, sizeof(*map));
+    if (file == NULL)
+        return false;
+    measure_map(file, &map->row_count, &map->col_count);
+    rewind(file);
+    if (map->row_count == 0 || !allocate_rows(map)) {
+        fclose(file);
+        sim_map_free(map);
+        return false;
+    }
+    for (size_t row = 0; row < map->row_count &&
+        getline(&line, &len, file) != -1; row++)
+        strncpy(map->rows[row], line, map->col_count);
+    free(line);
+    fclose(file);
+    return true;
+}
+
+bool sim_map_copy(sim_map_t *dst, const sim_map_t *src)
+{
+    if (dst->rows == NULL || dst->row_count != src->row_count ||
+        dst->col_count != src->col_count) {
+        sim_map_free(dst);
+        dst->row_count = src->row_count;
+        dst->col_count = src->col_count;
+        if (!allocate_rows(dst))
+            return false;
+    }
+    for (size_t i = 0; i < src->row_count; i++)
+        memcpy(dst->rows[i], src->rows[i], src->col_count + 1);
+    return true;
+}
+
+void sim_map_free(sim_map_t *map)
+{
+    if (map->rows != NULL) {
+        for (size_t i = 0; i < map->row_count; i++)
+            free(map->rows[i]);
+        free(map->rows);
+    }
+    map->rows = NULL;
+    map->row_count = 0;
+    map->col_count = 0;
+}
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Per-player movement and collision rules
+*/
+
+#include "sim.h"
+
+void sim_move_player(const sim_map_t *map, sim_player_t *player)
+{
+    size_t rise = 5 * 100 / map->row_count;
+
+    if (player->jetpack)
+        player->y = player->y < rise ? 0 : player->y - rise;
+    else
+        player->y += 3 * 100 / map->row_count;
+    player->x += 5 * 100 / map->col_count;
+    if (player->x >= SIM_WORLD_SIZE)
+        player->x = SIM_WORLD_SIZE - 1;
+    if (player->y >= SIM_WORLD_SIZE)
+        player->y = SIM_WORLD_SIZE - 1;
+}
+
+char *sim_cell(const sim_map_t *map, const sim_player_t *player,
+    uint32_t *cell_id)
+{
+    size_t row = player->y * map->row_count / SIM_WORLD_SIZE;
+    size_t col = player->x * map->col_count / SIM_WORLD_SIZE;
+
+    if (row >= map->row_count || col >= map->col_count)
+        return NULL;
+    if (cell_id != NULL)
+        *cell_id = (uint32_t)(row * map->col_count + col);
+    return &map->rows[row][col];
+}
+
+static void collect_coin(sim_t *sim, int index, char *cell, uint32_t cell_id)
+{
+    sim_player_t *player = &sim->players[index];
+    sim_coin_event_t *event;
+
+    player->score++;
+    player->collected_coin = true;
+    *cell = *cell == 'c' ? 'd' : '_';
+    if (sim->coin_event_count >= SIM_MAX_COIN_EVENTS)
+        return;
+    event = &sim->coin_events[sim->coin_event_count];
+    event->coin_id = cell_id;
+    event->collector = (uint8_t)index;
+    sim->coin_event_count++;
+}
+
+void sim_step_player(sim_t *sim, int index)
+{
+    sim_player_t *player = &sim->players[index];
+    uint32_t cell_id;
+    char *cell;
+
+    player->collected_coin = false;
+    if (!player->alive)
+        return;
+    sim_move_player(&sim->map, player);
+    cell = sim_cell(&sim->map, player, &cell_id);
+    if (cell == NULL)
+        return;
+    if (*cell == 'c' || *cell == 'd')
+        collect_coin(sim, index, cell, cell_id);
+    else if (*cell == 'e')
+        player->alive = false;
+}
@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Match setup and inputs for the simulation
+*/
+
+#include "sim.h"
+#include <string.h>
+
+void sim_init(sim_t *sim)
+{
+    memset(sim, 0, sizeof(*sim));
+    sim->start_x = SIM_START_X;
+    sim->start_y = SIM_START_Y;
+    sim->status = SIM_RUNNING;
+    sim->winner = SIM_NO_WINNER;
+}
+
+int sim_add_player(sim_t *sim)
+{
+    sim_player_t *player;
+
+    if (sim->player_count >= SIM_MAX_PLAYERS)
+        return -1;
+    player = &sim->players[sim->player_count];
+    memset(player, 0, sizeof(*player));
+    player->x = sim->start_x;
+    player->y = sim->start_y;
+    player->alive = true;
+    sim->player_count++;
+    return sim->player_count - 1;
+}
+
+void sim_set_input(sim_t *sim, int player, bool jetpack)
+{
+    if (player >= 0 && player < sim->player_count)
+        sim->players[player].jetpack = jetpack;
+}
+
+bool sim_restart(sim_t *sim, const sim_map_t *map)
+{
+    int players = sim->player_count;
+    sim_map_t rows = sim->map;
+
+    sim_init(sim);
+    sim->map = rows;
+    for (int i = 0; i < players; i++)
+        sim_add_player(sim);
+    return sim_map_copy(&sim->map, map);
+}
@@ -0,0 +1,60 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** One simulation tick and the end-of-match rules
+*/
+
+#include "sim.h"
+
+/* Best score among the living players past the finish line, and the number
+** of living players with the highest living id. */
+static int find_finisher(sim_t *sim, uint8_t *alive_id)
+{
+    const sim_player_t *player;
+    int alive_count = 0;
+    int best_score = -1;
+
+    sim->winner = SIM_NO_WINNER;
+    for (int i = 0; i < sim->player_count; i++) {
+        player = &sim->players[i];
+        if (!player->alive)
+            continue;
+        alive_count++;
+        *alive_id = (uint8_t)i;
+        if (player->x >= SIM_FINISH_X && player->score > best_score) {
+            best_score = player->score;
+            sim->winner = (uint8_t)i;
+        }
+    }
+    return alive_count;
+}
+
+static void update_outcome(sim_t *sim)
+{
+    uint8_t alive_id = SIM_NO_WINNER;
+    int alive_count = find_finisher(sim, &alive_id);
+
+    if (sim->winner == SIM_NO_WINNER && (alive_count == 0 ||
+        (alive_count == 1 && sim->player_count > 1)))
+        sim->winner = alive_id;
+    else if (sim->winner == SIM_NO_WINNER)
+        return;
+    sim->status = SIM_ENDED;
+}
+
+sim_status_t sim_step(sim_t *sim, const uint8_t *inputs)
+{
+    sim->coin_event_count = 0;
+    if (sim->status == SIM_ENDED || sim->map.row_count == 0 ||
+        sim->map.col_count == 0)
+        return sim->status;
+    for (int i = 0; i < sim->player_count; i++) {
+        if (inputs != NULL)
+            sim->players[i].jetpack = inputs[i] != 0;
+        sim_step_player(sim, i);
+    }
+    update_outcome(sim);
+    sim->tick++;
+    return sim->status;
+}
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Batch of matches played with random inputs
+*/
+
+#include "simulate.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static uint32_t next_random(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static uint64_t count_violations(const sim_t *sim, int coins)
+{
+    const sim_player_t *player;
+    uint64_t violations = 0;
+
+    for (int i = 0; i < sim->player_count; i++) {
+        player = &sim->players[i];
+        if (player->x >= SIM_WORLD_SIZE || player->y >= SIM_WORLD_SIZE)
+            violations++;
+        if (player->score < 0 || player->score > coins * 2)
+            violations++;
+    }
+    return violations;
+}
+
+static int count_coins(const sim_map_t *map)
+{
+    int coins = 0;
+
+    for (size_t row = 0; row < map->row_count; row++)
+        for (size_t col = 0; col < map->col_count; col++)
+            coins += map->rows[row][col] == 'c';
+    return coins;
+}
+
+static void play_match(sim_t *sim, const simulate_args_t *args,
+    uint32_t seed, batch_result_t *result)
+{
+    uint8_t inputs[SIM_MAX_PLAYERS] = {0};
+    int coins = count_coins(&sim->map);
+
+    while (sim->status == SIM_RUNNING && sim->tick < args->max_ticks) {
+        for (int i = 0; i < sim->player_count; i++)
+            inputs[i] ^= (next_random(&seed) & 7) == 0;
+        sim_step(sim, inputs);
+        result->violations += count_violations(sim, coins);
+    }
+    result->ticks += sim->tick;
+    result->timeouts += sim->status == SIM_RUNNING;
+    if (sim->status == SIM_ENDED && sim->winner == SIM_NO_WINNER)
+        result->no_winner++;
+    else if (sim->status == SIM_ENDED)
+        result->wins[sim->winner]++;
+    for (int i = 0; i < sim->player_count; i++)
+        result->total_score += sim->players[i].score;
+}
+
+int run_batch(const sim_map_t *map, const simulate_args_t *args)
+{
+    static sim_t sim;
+    batch_result_t result = {0};
+    struct timespec start;
+    struct timespec end;
+
+    sim_init(&sim);
+    for (int i = 0; i < args->players; i++)
+        sim_add_player(&sim);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int match = 0; match < args->matches; match++) {
+        if (!sim_restart(&sim, map))
+            return 84;
+        play_match(&sim, args, args->seed * 2654435761u + match + 1, &result);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    result.seconds = (end.tv_sec - start.tv_sec) +
+        (end.tv_nsec - start.tv_nsec) / 1e9;
+    sim_map_free(&sim.map);
+    print_batch(args, &result);
+    return result.violations == 0 ? 0 : 84;
+}
@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** jetpack_simulate entry point
+*/
+
+#include "simulate.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void display_help(void)
+{
+    printf("USAGE: ./jetpack_simulate -m <map> [-n <players>] "
+        "[-g <matches>] [-t <max ticks>] [-s <seed>] [-V]\n");
+    printf("  -n    players per match (default 2)\n");
+    printf("  -g    matches to play with random inputs (default 1000)\n");
+    printf("  -t    ticks before a match counts as a timeout "
+        "(default 10000)\n");
+    printf("  -s    seed of the random inputs (default 1)\n");
+    printf("  -V    only validate the map\n");
+}
+
+static int parse_option(simulate_args_t *args, char **argv, int i)
+{
+    if (strcmp(argv[i], "-m") == 0)
+        args->map_path = argv[i + 1];
+    if (strcmp(argv[i], "-n") == 0)
+        args->players = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-g") == 0)
+        args->matches = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-t") == 0)
+        args->max_ticks = (uint32_t)atoi(argv[i + 1]);
+    if (strcmp(argv[i], "-s") == 0)
+        args->seed = (uint32_t)atoi(argv[i + 1]);
+    return i + 2;
+}
+
+static int parse_args(int argc, char **argv, simulate_args_t *args)
+{
+    int i = 1;
+
+    while (i < argc) {
+        if (strcmp(argv[i], "-V") == 0) {
+            args->validate = true;
+            i++;
+            continue;
+        }
+        if (i + 1 >= argc || strchr("mngts", argv[i][1]) == NULL ||
+            argv[i][0] != '-' || argv[i][1] == '\0' || argv[i][2] != '\0')
+            return 84;
+        i = parse_option(args, argv, i);
+    }
+    if (args->map_path == NULL || args->players < 1 ||
+        args->players > SIM_MAX_PLAYERS || args->matches < 1)
+        return 84;
+    return 0;
+}
+
+void print_batch(const simulate_args_t *args,
+    const batch_result_t *result)
+{
+    printf("%d matches, %d players: %llu ticks in %.3f s (%.0f ticks/ms)\n",
+        args->matches, args->players, (unsigned long long)result->ticks,
+        result->seconds, result->ticks / (result->seconds * 1e3 + 1e-9));
+    printf("no winner: %d, timeouts: %d, mean score: %.2f, "
+        "rule violations: %llu\n", result->no_winner, result->timeouts,
+        (double)result->total_score / (args->matches * args->players),
+        (unsigned long long)result->violations);
+    for (int i = 0; i < args->players && i < 16; i++)
+        printf("  player %d won %u\n", i, result->wins[i]);
+}
+
+int main(int argc, char **argv)
+{
+    simulate_args_t args = {NULL, 2, 1000, 10000, 1, false};
+    sim_map_t map;
+    int status;
+
+    if (parse_args(argc, argv, &args) != 0) {
+        display_help();
+        return 84;
+    }
+    if (!sim_map_load(&map, args.map_path)) {
+        fprintf(stderr, "Cannot load map %s\n", args.map_path);
+        return 84;
+    }
+    status = validate_map(&map);
+    if (!args.validate)
+        status = run_batch(&map, &args);
+    sim_map_free(&map);
+    return status;
+}
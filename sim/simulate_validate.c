@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Static checks of a map: layout, tiles and a reachable finish line
+*/
+
+#include "simulate.h"
+#include <stdio.h>
+#include <string.h>
+
+static int count_tiles(const sim_map_t *map, int *coins, int *zappers)
+{
+    int unknown = 0;
+    char tile;
+
+    for (size_t row = 0; row < map->row_count; row++) {
+        for (size_t col = 0; col < map->col_count; col++) {
+            tile = map->rows[row][col];
+            *coins += tile == 'c' || tile == 'C';
+            *zappers += tile == 'e' || tile == 'E';
+            unknown += strchr("_#cCeE\n", tile) == NULL;
+        }
+    }
+    return unknown;
+}
+
+/* Rows keep their newline, so the widest row sets col_count one past the
+** last tile. */
+static int count_ragged_rows(const sim_map_t *map)
+{
+    int ragged = 0;
+
+    for (size_t row = 0; row < map->row_count; row++)
+        ragged += strcspn(map->rows[row], "\n") + 1 < map->col_count;
+    return ragged;
+}
+
+/* Every height reachable this tick, from every height reachable the tick
+** before, with either input and without touching a zapper. */
+static uint16_t advance(const sim_map_t *map, const bool *reach, bool *next,
+    uint16_t x)
+{
+    sim_player_t probe = {0};
+    uint16_t next_x = SIM_WORLD_SIZE;
+
+    memset(next, 0, (SIM_WORLD_SIZE + 1) * sizeof(bool));
+    for (int y = 0; y <= SIM_WORLD_SIZE; y++) {
+        for (int jetpack = 0; reach[y] && jetpack < 2; jetpack++) {
+            probe.x = x;
+            probe.y = (uint16_t)y;
+            probe.jetpack = jetpack;
+            sim_move_player(map, &probe);
+            if (sim_cell(map, &probe, NULL) != NULL &&
+                *sim_cell(map, &probe, NULL) == 'e')
+                continue;
+            next[probe.y] = true;
+            next_x = probe.x;
+        }
+    }
+    return next_x;
+}
+
+static int finish_tick(const sim_map_t *map)
+{
+    bool reach[SIM_WORLD_SIZE + 1] = {false};
+    bool next[SIM_WORLD_SIZE + 1];
+    uint16_t x = SIM_START_X;
+
+    if (map->col_count == 0 || 500 / map->col_count == 0)
+        return -1;
+    reach[SIM_START_Y] = true;
+    for (int tick = 1; tick <= SIM_WORLD_SIZE; tick++) {
+        x = advance(map, reach, next, x);
+        if (x == SIM_WORLD_SIZE)
+            return -1;
+        if (x >= SIM_FINISH_X)
+            return tick;
+        memcpy(reach, next, sizeof(reach));
+    }
+    return -1;
+}
+
+int validate_map(const sim_map_t *map)
+{
+    int coins = 0;
+    int zappers = 0;
+    int unknown = count_tiles(map, &coins, &zappers);
+    int ragged = count_ragged_rows(map);
+    int finish = finish_tick(map);
+
+    printf("map: %zu rows x %zu cols, %d coins, %d zappers\n",
+        map->row_count, map->col_count, coins, zappers);
+    if (unknown > 0)
+        printf("  %d unknown tiles (expected one of _#cCeE)\n", unknown);
+    if (ragged > 0)
+        printf("  %d rows shorter than the widest one\n", ragged);
+    if (finish < 0)
+        printf("  finish line unreachable\n");
+    else
+        printf("  finish line reachable in %d ticks\n", finish);
+    return unknown == 0 && ragged == 0 && finish >= 0 ? 0 : 84;
+}
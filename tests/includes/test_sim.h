@@ -0,0 +1,23 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Simulation rules tests (test_sim)
+*/
+
+#ifndef TEST_SIM_H_
+    #define TEST_SIM_H_
+
+    #include "sim.h"
+    #include "tests.h"
+
+// Rows of equal length, at most 16 of 16 cells; adds one player
+void test_sim_map(sim_t *sim, const char *const *rows, size_t row_count);
+
+void test_sim_clamp(void);
+void test_sim_ceiling(void);
+void test_sim_coin(void);
+void test_sim_zapper(void);
+void test_sim_finish(void);
+
+#endif /* !TEST_SIM_H_ */
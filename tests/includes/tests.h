@@ -0,0 +1,28 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Checks shared by the unit test executables (make tests_run)
+*/
+
+#ifndef TESTS_H_
+    #define TESTS_H_
+
+    #include <stdio.h>
+
+/*
+** A failed check is reported and counted, the test keeps going; each test
+** executable defines test_failures and exits with 84 when it is not 0.
+*/
+    #define TEST_CHECK(expr) \
+        do { \
+            if (!(expr)) { \
+                fprintf(stderr, "%s:%d: check failed: %s\n", \
+                    __FILE__, __LINE__, #expr); \
+                test_failures++; \
+            } \
+        } while (0)
+
+extern int test_failures;
+
+#endif /* !TESTS_H_ */
@@ -0,0 +1,46 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Simulation rules tests, in-memory maps
+*/
+
+#include "test_sim.h"
+#include <string.h>
+
+int test_failures = 0;
+
+/*
+** Rows are copied into buffers owned by this file, so the rules can mark
+** collected coins; every test starts from one player at the start line.
+*/
+void test_sim_map(sim_t *sim, const char *const *rows, size_t row_count)
+{
+    static char cells[16][17];
+    static char *pointers[16];
+
+    sim_init(sim);
+    for (size_t row = 0; row < row_count && row < 16; row++) {
+        strncpy(cells[row], rows[row], 16);
+        cells[row][16] = '\0';
+        pointers[row] = cells[row];
+    }
+    sim->map.rows = pointers;
+    sim->map.row_count = row_count;
+    sim->map.col_count = strlen(rows[0]);
+    sim_add_player(sim);
+}
+
+int main(void)
+{
+    test_sim_clamp();
+    test_sim_ceiling();
+    test_sim_coin();
+    test_sim_zapper();
+    test_sim_finish();
+    if (test_failures > 0) {
+        fprintf(stderr, "test_sim: %d checks failed\n", test_failures);
+        return 84;
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Server arenas and client slab pool
+*/
+
+#include "server.h"
+#include "tests.h"
+
+int test_failures = 0;
+
+// Aligned bump allocations, a spill into a second block once full
+static void test_arena_spill(void)
+{
+    arena_t arena;
+    uint8_t *first;
+    uint8_t *second;
+
+    TEST_CHECK(arena_init(&arena, 64));
+    first = arena_alloc(&arena, 3);
+    second = arena_alloc(&arena, 40);
+    TEST_CHECK((uintptr_t)first % ARENA_ALIGN == 0);
+    TEST_CHECK(second == first + ARENA_ALIGN);
+    TEST_CHECK(arena.head->next == NULL);
+    TEST_CHECK(arena_alloc(&arena, 32) != NULL);
+    TEST_CHECK(arena.head->next != NULL);
+    TEST_CHECK(arena.head->size == 128);
+    TEST_CHECK(arena_alloc(&arena, 1000) != NULL);
+    TEST_CHECK(arena.head->size == 1008);
+    arena_destroy(&arena);
+    TEST_CHECK(arena.head == NULL);
+}
+
+// A spilled cycle folds into one block, the same cycle then fits in it
+static void test_arena_reset(void)
+{
+    arena_t arena;
+    void *first;
+
+    TEST_CHECK(arena_init(&arena, 64));
+    first = arena_alloc(&arena, 48);
+    arena_reset(&arena);
+    TEST_CHECK(arena_alloc(&arena, 48) == first);
+    TEST_CHECK(arena_alloc(&arena, 100) != NULL);
+    arena_reset(&arena);
+    TEST_CHECK(arena.head->next == NULL);
+    TEST_CHECK(arena.head->size == 64 + 128);
+    TEST_CHECK(arena_alloc(&arena, 48) != NULL);
+    TEST_CHECK(arena_alloc(&arena, 100) != NULL);
+    TEST_CHECK(arena.head->next == NULL);
+    arena_destroy(&arena);
+}
+
+// Every slot once, distinct and inside the pool, then NULL
+static void test_slab_exhaust(void)
+{
+    slab_pool_t pool;
+    uint8_t *slots[4];
+
+    TEST_CHECK(slab_init(&pool, 24, 4));
+    for (int i = 0; i < 4; i++) {
+        slots[i] = slab_alloc(&pool);
+        TEST_CHECK(slots[i] == pool.slots + i * 24);
+    }
+    TEST_CHECK(slab_alloc(&pool) == NULL);
+    slab_free(&pool, slots[2]);
+    TEST_CHECK(slab_alloc(&pool) == slots[2]);
+    slab_destroy(&pool);
+    TEST_CHECK(pool.slots == NULL && pool.free_count == 0);
+}
+
+// Frees beyond capacity and of NULL leave the free stack untouched
+static void test_slab_reuse(void)
+{
+    slab_pool_t pool;
+    void *slot;
+
+    TEST_CHECK(slab_init(&pool, 8, 2));
+    slot = slab_alloc(&pool);
+    slab_free(&pool, NULL);
+    TEST_CHECK(pool.free_count == 1);
+    slab_free(&pool, slot);
+    slab_free(&pool, slot);
+    TEST_CHECK(pool.free_count == 2);
+    TEST_CHECK(slab_alloc(&pool) == slot);
+    slab_destroy(&pool);
+}
+
+int main(void)
+{
+    test_arena_spill();
+    test_arena_reset();
+    test_slab_exhaust();
+    test_slab_reuse();
+    if (test_failures > 0) {
+        fprintf(stderr, "test_alloc: %d checks failed\n", test_failures);
+        return 84;
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Replay writer to reader round trip, seeks and a full writer ring
+*/
+
+#include "replay/replay_reader.hpp"
+#include "tests.h"
+#include <algorithm>
+#include <cstdio>
+#include <set>
+
+int test_failures = 0;
+
+namespace {
+
+using jetpack::replay::ReplayFrame;
+using jetpack::replay::ReplayReader;
+
+const char *const REPLAY_PATH = "test_replay.jrp";
+const uint8_t MAP[] = "__c_e___c___"; // 3 rows of 4 cells
+constexpr uint32_t ROUND_TRIP_TICKS = 60; // Below the ring size: no drop
+constexpr uint32_t STRESS_TICKS = 20000;
+
+replay_writer_t *openWriter(uint32_t keyframeTicks) {
+  replay_file_header_t header = {};
+
+  header.player_count = 2;
+  header.map_rows = 3;
+  header.map_cols = 4;
+  header.tick_us = 16666;
+  header.keyframe_ticks = keyframeTicks;
+  return replay_writer_open(REPLAY_PATH, &header, MAP);
+}
+
+// Player p of tick t; every fifth tick p collects coin t
+void fillTick(replay_tick_t *tick, uint32_t t, bool last) {
+  tick->tick = t;
+  tick->status = last ? REPLAY_ENDED : REPLAY_RUNNING;
+  tick->winner = last ? 1 : jetpack::protocol::NO_WINNER;
+  for (uint32_t p = 0; p < 2; p++) {
+    tick->players.values[REPLAY_X][p] = t * 3 + p;
+    tick->players.values[REPLAY_Y][p] = 900 - t * 2 - p;
+    tick->players.values[REPLAY_SCORE][p] = t / 5;
+    tick->players.values[REPLAY_FLAGS][p] =
+        REPLAY_PLAYER_ALIVE | (t % 5 == 0 ? REPLAY_PLAYER_COIN : 0);
+  }
+  tick->coin_count = t % 5 == 0 ? 1 : 0;
+  tick->coins[0].coin_id = t;
+  tick->coins[0].collector = static_cast<uint8_t>(t % 2);
+}
+
+void writeTicks(replay_writer_t *writer, uint32_t count) {
+  for (uint32_t t = 0; t < count; t++) {
+    fillTick(replay_writer_slot(writer), t, t + 1 == count);
+    replay_writer_commit(writer);
+  }
+}
+
+// Key frames list every coin so far, delta frames the coins of their tick
+void checkFrame(const ReplayFrame &frame, uint32_t t) {
+  uint32_t coins = frame.key ? t / 5 + 1 : (t % 5 == 0 ? 1 : 0);
+
+  TEST_CHECK(frame.tick == t);
+  TEST_CHECK(frame.key == (t % 10 == 0));
+  TEST_CHECK(frame.ended == (t + 1 == ROUND_TRIP_TICKS));
+  TEST_CHECK(frame.players.size() == 2);
+  for (uint32_t p = 0; p < frame.players.size(); p++) {
+    TEST_CHECK(frame.players[p].posX == t * 3 + p);
+    TEST_CHECK(frame.players[p].posY == 900 - t * 2 - p);
+    TEST_CHECK(frame.players[p].score == t / 5);
+    TEST_CHECK(frame.players[p].alive);
+    TEST_CHECK(frame.players[p].collectedCoin == (t % 5 == 0));
+  }
+  TEST_CHECK(frame.coins.size() == coins);
+  if (!frame.coins.empty())
+    TEST_CHECK(frame.coins.back().coinId == t - t % 5);
+}
+
+void testRoundTrip() {
+  replay_writer_t *writer = openWriter(10);
+  ReplayReader reader;
+  ReplayFrame frame;
+  uint32_t t = 0;
+
+  TEST_CHECK(writer != nullptr);
+  if (writer == nullptr)
+    return;
+  writeTicks(writer, ROUND_TRIP_TICKS);
+  TEST_CHECK(replay_writer_dropped(writer) == 0);
+  replay_writer_close(writer);
+  TEST_CHECK(reader.open(REPLAY_PATH));
+  TEST_CHECK(reader.header().tick_count == ROUND_TRIP_TICKS);
+  TEST_CHECK(reader.map().size() == 12 &&
+             std::equal(reader.map().begin(), reader.map().end(), MAP));
+  TEST_CHECK(reader.firstTick() == 0);
+  TEST_CHECK(reader.lastTick() == ROUND_TRIP_TICKS - 1);
+  for (; reader.next(&frame); t++)
+    checkFrame(frame, t);
+  TEST_CHECK(t == ROUND_TRIP_TICKS);
+  TEST_CHECK(frame.winnerId == 1);
+  reader.seek(35);
+  TEST_CHECK(reader.next(&frame));
+  checkFrame(frame, 30);
+}
+
+/*
+** The producer outruns the writer thread: ticks may be dropped, but every
+** coin still reaches the file and the last frame is the final state.
+*/
+void testFullRing() {
+  replay_writer_t *writer = openWriter(0);
+  std::set<uint32_t> coins;
+  ReplayReader reader;
+  ReplayFrame frame;
+  uint32_t frames = 0;
+  uint32_t dropped = 0;
+
+  TEST_CHECK(writer != nullptr);
+  if (writer == nullptr)
+    return;
+  writeTicks(writer, STRESS_TICKS);
+  dropped = replay_writer_dropped(writer);
+  replay_writer_close(writer);
+  TEST_CHECK(reader.open(REPLAY_PATH));
+  for (; reader.next(&frame); frames++)
+    for (const auto &coin : frame.coins)
+      coins.insert(coin.coinId);
+  std::printf("test_replay: %u of %u ticks dropped on a full ring\n",
+              dropped, STRESS_TICKS);
+  TEST_CHECK(frames + dropped == STRESS_TICKS);
+  TEST_CHECK(coins.size() == STRESS_TICKS / 5);
+  TEST_CHECK(frame.ended && frame.tick == STRESS_TICKS - 1);
+}
+
+} // namespace
+
+int main() {
+  testRoundTrip();
+  testFullRing();
+  std::remove(REPLAY_PATH);
+  if (test_failures > 0) {
+    std::fprintf(stderr, "test_replay: %d checks failed\n", test_failures);
+    return 84;
+  }
+  return 0;
+}
@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Movement bounds and coin collection
+*/
+
+#include "test_sim.h"
+
+static const char *const EMPTY[] = {"__________", "__________",
+    "__________", "__________", "__________", "__________", "__________",
+    "__________", "__________", "__________"};
+
+// Falling from the start line stops on the floor, the jetpack at the roof
+void test_sim_clamp(void)
+{
+    sim_t sim;
+
+    test_sim_map(&sim, EMPTY, 10);
+    sim_step(&sim, NULL);
+    TEST_CHECK(sim.players[0].y == SIM_WORLD_SIZE - 1);
+    TEST_CHECK(sim.players[0].x == SIM_START_X + 50);
+    sim_set_input(&sim, 0, true);
+    sim_step(&sim, NULL);
+    TEST_CHECK(sim.players[0].y == SIM_WORLD_SIZE - 1 - 50);
+    sim.players[0].y = 20;
+    sim_step(&sim, NULL);
+    TEST_CHECK(sim.players[0].y == 0);
+    TEST_CHECK(sim.status == SIM_RUNNING);
+}
+
+// Rising past the top stops at y = 0, as the server did before sim/
+void test_sim_ceiling(void)
+{
+    static const uint16_t from[] = {0, 20, 49, 50, 51, 999};
+    static const uint16_t to[] = {0, 0, 0, 0, 1, 949};
+    sim_t sim;
+
+    test_sim_map(&sim, EMPTY, 10);
+    sim_set_input(&sim, 0, true);
+    for (int i = 0; i < 6; i++) {
+        sim.players[0].x = SIM_START_X;
+        sim.players[0].y = from[i];
+        sim_step(&sim, NULL);
+        TEST_CHECK(sim.players[0].y == to[i]);
+    }
+}
+
+// One event on the step that takes the coin, none on the next
+void test_sim_coin(void)
+{
+    const char *rows[10] = {0};
+    sim_t sim;
+
+    for (int i = 0; i < 10; i++)
+        rows[i] = i == 9 ? "c_________" : EMPTY[i];
+    test_sim_map(&sim, rows, 10);
+    sim_step(&sim, NULL);
+    TEST_CHECK(sim.players[0].score == 1);
+    TEST_CHECK(sim.players[0].collected_coin);
+    TEST_CHECK(sim.coin_event_count == 1);
+    TEST_CHECK(sim.coin_events[0].coin_id == 9 * 10);
+    TEST_CHECK(sim.coin_events[0].collector == 0);
+    TEST_CHECK(sim.map.rows[9][0] == 'd');
+    sim_step(&sim, NULL);
+    TEST_CHECK(!sim.players[0].collected_coin);
+    TEST_CHECK(sim.coin_event_count == 0);
+}
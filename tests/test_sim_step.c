@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** End-of-match rules: zappers, last player alive, finish line
+*/
+
+#include "test_sim.h"
+
+static const char *const ZAPPED[] = {"__________", "__________",
+    "__________", "__________", "__________", "c_________", "__________",
+    "__________", "__________", "e_________"};
+
+// Steps until the match ends, 0 if it is still running after limit steps
+static uint32_t run_to_end(sim_t *sim, int limit)
+{
+    for (int i = 0; i < limit; i++)
+        if (sim_step(sim, NULL) == SIM_ENDED)
+            return sim->tick;
+    return 0;
+}
+
+// Nobody left: no winner; one player left out of two: that player wins
+void test_sim_zapper(void)
+{
+    sim_t sim;
+
+    test_sim_map(&sim, ZAPPED, 10);
+    TEST_CHECK(run_to_end(&sim, 1) == 1);
+    TEST_CHECK(!sim.players[0].alive);
+    TEST_CHECK(sim.winner == SIM_NO_WINNER);
+    TEST_CHECK(sim_step(&sim, NULL) == SIM_ENDED);
+    TEST_CHECK(sim.tick == 1);
+    test_sim_map(&sim, ZAPPED, 10);
+    sim_add_player(&sim);
+    sim.players[1].y = 500;
+    TEST_CHECK(run_to_end(&sim, 1) == 1);
+    TEST_CHECK(sim.players[1].alive);
+    TEST_CHECK(sim.winner == 1);
+}
+
+// Both players cross the line on the same step, the best score wins
+void test_sim_finish(void)
+{
+    sim_t sim;
+
+    test_sim_map(&sim, ZAPPED, 10);
+    sim_add_player(&sim);
+    sim.players[0].y = 200;
+    sim.players[1].y = 500;
+    TEST_CHECK(run_to_end(&sim, 100) == 20);
+    TEST_CHECK(sim.players[0].x == SIM_FINISH_X);
+    TEST_CHECK(sim.players[1].score == 1);
+    TEST_CHECK(sim.winner == 1);
+}
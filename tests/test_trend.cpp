@@ -0,0 +1,62 @@
+// Copyright 2025 paul-antoine.salmon@epitech.eu
+/*
+** EPITECH PROJECT, 2025
+** Jetpack
+** File description:
+** Least-squares growth detection of jetpack_soak
+*/
+
+#include "soak/trend.hpp"
+#include "tests.h"
+#include <cmath>
+#include <cstdio>
+
+int test_failures = 0;
+
+namespace {
+
+using jetpack::soak::fitTrend;
+using jetpack::soak::Trend;
+
+bool near(double value, double expected) {
+  return std::fabs(value - expected) < 1e-9;
+}
+
+// A straight line is fitted exactly, growth is judged against the limit
+void testLine() {
+  Trend trend = fitTrend("rss", {3.0, 5.0, 7.0, 9.0, 11.0}, 1.0);
+
+  TEST_CHECK(trend.name == "rss");
+  TEST_CHECK(near(trend.slopePerMatch, 2.0));
+  TEST_CHECK(near(trend.first, 3.0) && near(trend.last, 11.0));
+  TEST_CHECK(trend.growing);
+  TEST_CHECK(!fitTrend("rss", {3.0, 5.0, 7.0, 9.0, 11.0}, 2.0).growing);
+  TEST_CHECK(!fitTrend("fds", {8.0, 8.0, 8.0}, 0.0).growing);
+  TEST_CHECK(near(fitTrend("fds", {8.0, 8.0, 8.0}, 0.0).slopePerMatch, 0.0));
+}
+
+// Noise around a slope, a series back to its start, too few samples
+void testEdges() {
+  Trend noisy = fitTrend("rss", {10.0, 14.0, 11.0, 15.0, 12.0, 16.0}, 0.1);
+  Trend back = fitTrend("rss", {10.0, 20.0, 30.0, 40.0, 9.0}, 0.1);
+  Trend single = fitTrend("rss", {42.0}, 0.0);
+
+  TEST_CHECK(near(noisy.slopePerMatch, 0.8));
+  TEST_CHECK(noisy.growing);
+  TEST_CHECK(back.slopePerMatch > 0.1);
+  TEST_CHECK(!back.growing);
+  TEST_CHECK(near(single.slopePerMatch, 0.0) && !single.growing);
+  TEST_CHECK(!fitTrend("rss", {}, 0.0).growing);
+}
+
+} // namespace
+
+int main() {
+  testLine();
+  testEdges();
+  if (test_failures > 0) {
+    std::fprintf(stderr, "test_trend: %d checks failed\n", test_failures);
+    return 84;
+  }
+  return 0;
+}